@@ -0,0 +1,391 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeFilters.cmake"
+  "/root/repo/CMakeInstallation.cmake"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CMakePlugins.cmake"
+  "/root/repo/CTestConfig.cmake"
+  "/root/repo/UserMacros.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/c++/CMakeLists.txt"
+  "/root/repo/c++/examples/CMakeLists.txt"
+  "/root/repo/c++/examples/CMakeTests.cmake"
+  "/root/repo/c++/src/CMakeLists.txt"
+  "/root/repo/c++/test/CMakeLists.txt"
+  "/root/repo/c++/test/CMakeTests.cmake"
+  "/root/repo/c++/test/H5srcdir_str.h.in"
+  "/root/repo/config/cmake/CTestCustom.cmake"
+  "/root/repo/config/cmake/ConfigureChecks.cmake"
+  "/root/repo/config/cmake/H5cxx_config.h.in"
+  "/root/repo/config/cmake/H5pubconf.h.in"
+  "/root/repo/config/cmake/HDF5Macros.cmake"
+  "/root/repo/config/cmake/HDF5PluginMacros.cmake"
+  "/root/repo/config/cmake/HDFCXXCompilerFlags.cmake"
+  "/root/repo/config/cmake/HDFCompilerFlags.cmake"
+  "/root/repo/config/cmake/README.txt.cmake.in"
+  "/root/repo/config/cmake/hdf5-config.cmake.in"
+  "/root/repo/config/cmake/libh5cc.in"
+  "/root/repo/config/cmake/libhdf5.settings.cmake.in"
+  "/root/repo/config/cmake_ext_mod/ConfigureChecks.cmake"
+  "/root/repo/config/cmake_ext_mod/HDFLibMacros.cmake"
+  "/root/repo/config/cmake_ext_mod/HDFMacros.cmake"
+  "/root/repo/config/cmake_ext_mod/HDFUseCXX.cmake"
+  "/root/repo/config/libhdf5.pc.in"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/CMakeTests.cmake"
+  "/root/repo/hl/CMakeLists.txt"
+  "/root/repo/hl/c++/CMakeLists.txt"
+  "/root/repo/hl/c++/examples/CMakeLists.txt"
+  "/root/repo/hl/c++/examples/CMakeTests.cmake"
+  "/root/repo/hl/c++/src/CMakeLists.txt"
+  "/root/repo/hl/c++/test/CMakeLists.txt"
+  "/root/repo/hl/c++/test/CMakeTests.cmake"
+  "/root/repo/hl/examples/CMakeLists.txt"
+  "/root/repo/hl/examples/CMakeTests.cmake"
+  "/root/repo/hl/src/CMakeLists.txt"
+  "/root/repo/hl/test/CMakeLists.txt"
+  "/root/repo/hl/test/CMakeTests.cmake"
+  "/root/repo/hl/test/H5srcdir_str.h.in"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/CMakeTests.cmake"
+  "/root/repo/test/H5srcdir_str.h.in"
+  "/root/repo/utils/CMakeLists.txt"
+  "/root/repo/utils/mirror_vfd/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMinorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckStructHasMember.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckVariableExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCygwin.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMsys.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPerl.cmake"
+  "/usr/share/cmake-3.25/Modules/InstallRequiredSystemLibraries.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Modules/TestForSTDNamespace.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CTestCustom.ctest"
+  "src/H5pubconf.h"
+  "hdf5-config.cmake"
+  "CMakeFiles/hdf5-config.cmake"
+  "CMakeFiles/hdf5-config-version.cmake"
+  "src/libhdf5.settings"
+  "README.txt"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "CMakeFiles/hdf5-1.13.0.pc"
+  "CMakeFiles/h5cc"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/H5srcdir_str.h"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/mirror_vfd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "CMakeFiles/hdf5_hl-1.13.0.pc"
+  "CMakeFiles/h5hlcc"
+  "hl/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hl/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hl/test/H5srcdir_str.h"
+  "hl/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "c++/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/H5cxx_pubconf.h"
+  "CMakeFiles/hdf5_cpp-1.13.0.pc"
+  "CMakeFiles/h5c++"
+  "c++/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "c++/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "c++/test/H5srcdir_str.h"
+  "c++/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hl/c++/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "CMakeFiles/hdf5_hl_cpp-1.13.0.pc"
+  "CMakeFiles/h5hlc++"
+  "hl/c++/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hl/c++/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hl/c++/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "src/CMakeFiles/H5make_libsettings.dir/DependInfo.cmake"
+  "src/CMakeFiles/gen_hdf5-static.dir/DependInfo.cmake"
+  "src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  "test/CMakeFiles/hdf5_test-static.dir/DependInfo.cmake"
+  "test/CMakeFiles/cache.dir/DependInfo.cmake"
+  "test/CMakeFiles/cache_api.dir/DependInfo.cmake"
+  "test/CMakeFiles/cache_tagging.dir/DependInfo.cmake"
+  "test/CMakeFiles/lheap.dir/DependInfo.cmake"
+  "test/CMakeFiles/ohdr.dir/DependInfo.cmake"
+  "test/CMakeFiles/stab.dir/DependInfo.cmake"
+  "test/CMakeFiles/gheap.dir/DependInfo.cmake"
+  "test/CMakeFiles/evict_on_close.dir/DependInfo.cmake"
+  "test/CMakeFiles/farray.dir/DependInfo.cmake"
+  "test/CMakeFiles/earray.dir/DependInfo.cmake"
+  "test/CMakeFiles/btree2.dir/DependInfo.cmake"
+  "test/CMakeFiles/fheap.dir/DependInfo.cmake"
+  "test/CMakeFiles/pool.dir/DependInfo.cmake"
+  "test/CMakeFiles/accum.dir/DependInfo.cmake"
+  "test/CMakeFiles/hyperslab.dir/DependInfo.cmake"
+  "test/CMakeFiles/istore.dir/DependInfo.cmake"
+  "test/CMakeFiles/bittests.dir/DependInfo.cmake"
+  "test/CMakeFiles/dt_arith.dir/DependInfo.cmake"
+  "test/CMakeFiles/page_buffer.dir/DependInfo.cmake"
+  "test/CMakeFiles/dtypes.dir/DependInfo.cmake"
+  "test/CMakeFiles/dsets.dir/DependInfo.cmake"
+  "test/CMakeFiles/cmpd_dset.dir/DependInfo.cmake"
+  "test/CMakeFiles/filter_fail.dir/DependInfo.cmake"
+  "test/CMakeFiles/extend.dir/DependInfo.cmake"
+  "test/CMakeFiles/external.dir/DependInfo.cmake"
+  "test/CMakeFiles/external_env.dir/DependInfo.cmake"
+  "test/CMakeFiles/efc.dir/DependInfo.cmake"
+  "test/CMakeFiles/objcopy_ref.dir/DependInfo.cmake"
+  "test/CMakeFiles/objcopy.dir/DependInfo.cmake"
+  "test/CMakeFiles/links.dir/DependInfo.cmake"
+  "test/CMakeFiles/unlink.dir/DependInfo.cmake"
+  "test/CMakeFiles/twriteorder.dir/DependInfo.cmake"
+  "test/CMakeFiles/big.dir/DependInfo.cmake"
+  "test/CMakeFiles/mtime.dir/DependInfo.cmake"
+  "test/CMakeFiles/fillval.dir/DependInfo.cmake"
+  "test/CMakeFiles/mount.dir/DependInfo.cmake"
+  "test/CMakeFiles/flush1.dir/DependInfo.cmake"
+  "test/CMakeFiles/flush2.dir/DependInfo.cmake"
+  "test/CMakeFiles/app_ref.dir/DependInfo.cmake"
+  "test/CMakeFiles/enum.dir/DependInfo.cmake"
+  "test/CMakeFiles/set_extent.dir/DependInfo.cmake"
+  "test/CMakeFiles/enc_dec_plist.dir/DependInfo.cmake"
+  "test/CMakeFiles/enc_dec_plist_cross_platform.dir/DependInfo.cmake"
+  "test/CMakeFiles/getname.dir/DependInfo.cmake"
+  "test/CMakeFiles/vfd.dir/DependInfo.cmake"
+  "test/CMakeFiles/ros3.dir/DependInfo.cmake"
+  "test/CMakeFiles/s3comms.dir/DependInfo.cmake"
+  "test/CMakeFiles/hdfs.dir/DependInfo.cmake"
+  "test/CMakeFiles/ntypes.dir/DependInfo.cmake"
+  "test/CMakeFiles/dangle.dir/DependInfo.cmake"
+  "test/CMakeFiles/dtransform.dir/DependInfo.cmake"
+  "test/CMakeFiles/cross_read.dir/DependInfo.cmake"
+  "test/CMakeFiles/freespace.dir/DependInfo.cmake"
+  "test/CMakeFiles/mf.dir/DependInfo.cmake"
+  "test/CMakeFiles/vds.dir/DependInfo.cmake"
+  "test/CMakeFiles/vds_env.dir/DependInfo.cmake"
+  "test/CMakeFiles/file_image.dir/DependInfo.cmake"
+  "test/CMakeFiles/unregister.dir/DependInfo.cmake"
+  "test/CMakeFiles/cache_logging.dir/DependInfo.cmake"
+  "test/CMakeFiles/cork.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr.dir/DependInfo.cmake"
+  "test/CMakeFiles/vol.dir/DependInfo.cmake"
+  "test/CMakeFiles/timer.dir/DependInfo.cmake"
+  "test/CMakeFiles/cmpd_dtransform.dir/DependInfo.cmake"
+  "test/CMakeFiles/map.dir/DependInfo.cmake"
+  "test/CMakeFiles/chunk_info.dir/DependInfo.cmake"
+  "test/CMakeFiles/direct_chunk.dir/DependInfo.cmake"
+  "test/CMakeFiles/testhdf5.dir/DependInfo.cmake"
+  "test/CMakeFiles/cache_image.dir/DependInfo.cmake"
+  "test/CMakeFiles/ttsafe.dir/DependInfo.cmake"
+  "test/CMakeFiles/thread_id.dir/DependInfo.cmake"
+  "test/CMakeFiles/mirror_vfd.dir/DependInfo.cmake"
+  "test/CMakeFiles/event_set.dir/DependInfo.cmake"
+  "test/CMakeFiles/error_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/err_compat.dir/DependInfo.cmake"
+  "test/CMakeFiles/tcheck_version.dir/DependInfo.cmake"
+  "test/CMakeFiles/testmeta.dir/DependInfo.cmake"
+  "test/CMakeFiles/atomic_writer.dir/DependInfo.cmake"
+  "test/CMakeFiles/atomic_reader.dir/DependInfo.cmake"
+  "test/CMakeFiles/links_env.dir/DependInfo.cmake"
+  "test/CMakeFiles/filenotclosed.dir/DependInfo.cmake"
+  "test/CMakeFiles/del_many_dense_attrs.dir/DependInfo.cmake"
+  "test/CMakeFiles/flushrefresh.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_addrem_writer.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_check_compat_vfd.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_generator.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_reader.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_remove_reader.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_remove_writer.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_sparse_reader.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_sparse_writer.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_start_write.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_writer.dir/DependInfo.cmake"
+  "test/CMakeFiles/vds_swmr_gen.dir/DependInfo.cmake"
+  "test/CMakeFiles/vds_swmr_reader.dir/DependInfo.cmake"
+  "test/CMakeFiles/vds_swmr_writer.dir/DependInfo.cmake"
+  "test/CMakeFiles/accum_swmr_reader.dir/DependInfo.cmake"
+  "test/CMakeFiles/use_append_chunk.dir/DependInfo.cmake"
+  "test/CMakeFiles/use_append_chunk_mirror.dir/DependInfo.cmake"
+  "test/CMakeFiles/use_append_mchunks.dir/DependInfo.cmake"
+  "test/CMakeFiles/use_disable_mdc_flushes.dir/DependInfo.cmake"
+  "test/CMakeFiles/HDF5_TEST_LIB_files.dir/DependInfo.cmake"
+  "utils/mirror_vfd/CMakeFiles/mirror_server.dir/DependInfo.cmake"
+  "utils/mirror_vfd/CMakeFiles/mirror_server_stop.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_crtdat.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_rdwt.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_crtatt.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_crtgrp.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_crtgrpar.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_crtgrpd.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_cmprss.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_extend.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_subset.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_write.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_read.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_extend_write.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_chunk_read.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_compound.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_group.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_select.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_attribute.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_mount.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_ref_extern.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_ref_compat.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_reference_deprec.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_drivers.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_ref2reg_deprec.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_extlink.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_elink_unix2win.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_shared_mesg.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_debug_trace.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_vds.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_vds-exc.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_vds-exclim.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_vds-eiger.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_vds-simpleIO.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_vds-percival.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_vds-percival-unlim.dir/DependInfo.cmake"
+  "examples/CMakeFiles/h5_vds-percival-unlim-maxmin.dir/DependInfo.cmake"
+  "hl/src/CMakeFiles/hdf5_hl-static.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_lite1.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_lite2.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_lite3.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ptExampleFL.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_image1.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_image2.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_table_01.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_table_02.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_table_03.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_table_04.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_table_05.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_table_06.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_table_07.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_table_08.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_table_09.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_table_10.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_table_11.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_table_12.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_ds1.dir/DependInfo.cmake"
+  "hl/examples/CMakeFiles/hl_ex_ex_ds1_files.dir/DependInfo.cmake"
+  "hl/test/CMakeFiles/hl_test_lite.dir/DependInfo.cmake"
+  "hl/test/CMakeFiles/hl_test_image.dir/DependInfo.cmake"
+  "hl/test/CMakeFiles/hl_test_file_image.dir/DependInfo.cmake"
+  "hl/test/CMakeFiles/hl_test_table.dir/DependInfo.cmake"
+  "hl/test/CMakeFiles/hl_test_ds.dir/DependInfo.cmake"
+  "hl/test/CMakeFiles/hl_test_ld.dir/DependInfo.cmake"
+  "hl/test/CMakeFiles/hl_test_dset_append.dir/DependInfo.cmake"
+  "hl/test/CMakeFiles/hl_test_h5do_compat.dir/DependInfo.cmake"
+  "hl/test/CMakeFiles/hl_test_packet.dir/DependInfo.cmake"
+  "hl/test/CMakeFiles/hl_test_files.dir/DependInfo.cmake"
+  "c++/src/CMakeFiles/hdf5_cpp-static.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_create.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_readdata.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_writedata.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_compound.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_extend_ds.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_chunks.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_h5group.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_h5tutr_cmprss.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_h5tutr_crtdat.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_h5tutr_crtatt.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_h5tutr_crtgrpar.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_h5tutr_crtgrp.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_h5tutr_crtgrpd.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_h5tutr_extend.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_h5tutr_rdwt.dir/DependInfo.cmake"
+  "c++/examples/CMakeFiles/cpp_ex_h5tutr_subset.dir/DependInfo.cmake"
+  "c++/test/CMakeFiles/cpp_testhdf5.dir/DependInfo.cmake"
+  "c++/test/CMakeFiles/cpp_testhdf5_files.dir/DependInfo.cmake"
+  "hl/c++/src/CMakeFiles/hdf5_hl_cpp-static.dir/DependInfo.cmake"
+  "hl/c++/examples/CMakeFiles/ptExampleFL.dir/DependInfo.cmake"
+  "hl/c++/test/CMakeFiles/hl_ptableTest.dir/DependInfo.cmake"
+  )
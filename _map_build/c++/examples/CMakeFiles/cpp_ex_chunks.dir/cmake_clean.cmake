@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_chunks"
+  "../../bin/cpp_ex_chunks.pdb"
+  "CMakeFiles/cpp_ex_chunks.dir/chunks.cpp.o"
+  "CMakeFiles/cpp_ex_chunks.dir/chunks.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_chunks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
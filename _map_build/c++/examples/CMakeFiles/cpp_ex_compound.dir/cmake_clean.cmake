@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_compound"
+  "../../bin/cpp_ex_compound.pdb"
+  "CMakeFiles/cpp_ex_compound.dir/compound.cpp.o"
+  "CMakeFiles/cpp_ex_compound.dir/compound.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_compound.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
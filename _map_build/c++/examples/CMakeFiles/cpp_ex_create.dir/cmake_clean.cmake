@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_create"
+  "../../bin/cpp_ex_create.pdb"
+  "CMakeFiles/cpp_ex_create.dir/create.cpp.o"
+  "CMakeFiles/cpp_ex_create.dir/create.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_create.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_extend_ds"
+  "../../bin/cpp_ex_extend_ds.pdb"
+  "CMakeFiles/cpp_ex_extend_ds.dir/extend_ds.cpp.o"
+  "CMakeFiles/cpp_ex_extend_ds.dir/extend_ds.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_extend_ds.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_h5group"
+  "../../bin/cpp_ex_h5group.pdb"
+  "CMakeFiles/cpp_ex_h5group.dir/h5group.cpp.o"
+  "CMakeFiles/cpp_ex_h5group.dir/h5group.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_h5group.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
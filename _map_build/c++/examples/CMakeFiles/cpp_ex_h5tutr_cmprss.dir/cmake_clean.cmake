@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_h5tutr_cmprss"
+  "../../bin/cpp_ex_h5tutr_cmprss.pdb"
+  "CMakeFiles/cpp_ex_h5tutr_cmprss.dir/h5tutr_cmprss.cpp.o"
+  "CMakeFiles/cpp_ex_h5tutr_cmprss.dir/h5tutr_cmprss.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_h5tutr_cmprss.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_h5tutr_crtatt"
+  "../../bin/cpp_ex_h5tutr_crtatt.pdb"
+  "CMakeFiles/cpp_ex_h5tutr_crtatt.dir/h5tutr_crtatt.cpp.o"
+  "CMakeFiles/cpp_ex_h5tutr_crtatt.dir/h5tutr_crtatt.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_h5tutr_crtatt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_h5tutr_crtdat"
+  "../../bin/cpp_ex_h5tutr_crtdat.pdb"
+  "CMakeFiles/cpp_ex_h5tutr_crtdat.dir/h5tutr_crtdat.cpp.o"
+  "CMakeFiles/cpp_ex_h5tutr_crtdat.dir/h5tutr_crtdat.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_h5tutr_crtdat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_h5tutr_crtgrp"
+  "../../bin/cpp_ex_h5tutr_crtgrp.pdb"
+  "CMakeFiles/cpp_ex_h5tutr_crtgrp.dir/h5tutr_crtgrp.cpp.o"
+  "CMakeFiles/cpp_ex_h5tutr_crtgrp.dir/h5tutr_crtgrp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_h5tutr_crtgrp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_h5tutr_crtgrpar"
+  "../../bin/cpp_ex_h5tutr_crtgrpar.pdb"
+  "CMakeFiles/cpp_ex_h5tutr_crtgrpar.dir/h5tutr_crtgrpar.cpp.o"
+  "CMakeFiles/cpp_ex_h5tutr_crtgrpar.dir/h5tutr_crtgrpar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_h5tutr_crtgrpar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_h5tutr_crtgrpd"
+  "../../bin/cpp_ex_h5tutr_crtgrpd.pdb"
+  "CMakeFiles/cpp_ex_h5tutr_crtgrpd.dir/h5tutr_crtgrpd.cpp.o"
+  "CMakeFiles/cpp_ex_h5tutr_crtgrpd.dir/h5tutr_crtgrpd.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_h5tutr_crtgrpd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_h5tutr_extend"
+  "../../bin/cpp_ex_h5tutr_extend.pdb"
+  "CMakeFiles/cpp_ex_h5tutr_extend.dir/h5tutr_extend.cpp.o"
+  "CMakeFiles/cpp_ex_h5tutr_extend.dir/h5tutr_extend.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_h5tutr_extend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
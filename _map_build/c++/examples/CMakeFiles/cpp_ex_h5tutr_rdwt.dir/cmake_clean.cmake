@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_h5tutr_rdwt"
+  "../../bin/cpp_ex_h5tutr_rdwt.pdb"
+  "CMakeFiles/cpp_ex_h5tutr_rdwt.dir/h5tutr_rdwt.cpp.o"
+  "CMakeFiles/cpp_ex_h5tutr_rdwt.dir/h5tutr_rdwt.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_h5tutr_rdwt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_h5tutr_subset"
+  "../../bin/cpp_ex_h5tutr_subset.pdb"
+  "CMakeFiles/cpp_ex_h5tutr_subset.dir/h5tutr_subset.cpp.o"
+  "CMakeFiles/cpp_ex_h5tutr_subset.dir/h5tutr_subset.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_h5tutr_subset.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_readdata"
+  "../../bin/cpp_ex_readdata.pdb"
+  "CMakeFiles/cpp_ex_readdata.dir/readdata.cpp.o"
+  "CMakeFiles/cpp_ex_readdata.dir/readdata.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_readdata.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpp_ex_writedata"
+  "../../bin/cpp_ex_writedata.pdb"
+  "CMakeFiles/cpp_ex_writedata.dir/writedata.cpp.o"
+  "CMakeFiles/cpp_ex_writedata.dir/writedata.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpp_ex_writedata.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/c++/examples
+# Build directory: /root/repo/_map_build/c++/examples
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CPP_ex-clear-objects "/usr/bin/cmake" "-E" "remove" "Group.h5" "SDS.h5" "SDScompound.h5" "SDSextendible.h5" "Select.h5")
+set_tests_properties(CPP_ex-clear-objects PROPERTIES  FIXTURES_SETUP "clear_cppex" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;19;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_create "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_create" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_create.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_create PROPERTIES  FIXTURES_REQUIRED "clear_cppex" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;35;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_readdata "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_readdata" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_readdata.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_readdata PROPERTIES  DEPENDS "CPP_ex_create" FIXTURES_REQUIRED "clear_cppex" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;35;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_writedata "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_writedata" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_writedata.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_writedata PROPERTIES  DEPENDS "CPP_ex_readdata" FIXTURES_REQUIRED "clear_cppex" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;35;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_compound "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_compound" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_compound.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_compound PROPERTIES  DEPENDS "CPP_ex_writedata" FIXTURES_REQUIRED "clear_cppex" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;35;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_extend_ds "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_extend_ds" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_extend_ds.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_extend_ds PROPERTIES  DEPENDS "CPP_ex_compound" FIXTURES_REQUIRED "clear_cppex" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;35;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_chunks "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_chunks" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_chunks.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_chunks PROPERTIES  DEPENDS "CPP_ex_extend_ds" FIXTURES_REQUIRED "clear_cppex" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;35;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_h5group "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_h5group" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_h5group.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_h5group PROPERTIES  DEPENDS "CPP_ex_chunks" FIXTURES_REQUIRED "clear_cppex" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;35;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_tutr-clear-objects "/usr/bin/cmake" "-E" "remove" "h5tutr_cmprss.h5" "h5tutr_dset.h5" "h5tutr_extend.h5" "h5tutr_group.h5" "h5tutr_groups.h5" "h5tutr_subset.h5")
+set_tests_properties(CPP_ex_tutr-clear-objects PROPERTIES  FIXTURES_SETUP "clear_cppex_tutr" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;57;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_h5tutr_cmprss "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_h5tutr_cmprss" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_h5tutr_cmprss.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_h5tutr_cmprss PROPERTIES  DEPENDS "CPP_ex_h5group" FIXTURES_REQUIRED "clear_cppex_tutr" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;74;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_h5tutr_crtdat "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_h5tutr_crtdat" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_h5tutr_crtdat.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_h5tutr_crtdat PROPERTIES  DEPENDS "CPP_ex_h5tutr_cmprss" FIXTURES_REQUIRED "clear_cppex_tutr" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;74;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_h5tutr_crtatt "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_h5tutr_crtatt" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_h5tutr_crtatt.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_h5tutr_crtatt PROPERTIES  DEPENDS "CPP_ex_h5tutr_crtdat" FIXTURES_REQUIRED "clear_cppex_tutr" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;74;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_h5tutr_crtgrpar "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_h5tutr_crtgrpar" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_h5tutr_crtgrpar.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_h5tutr_crtgrpar PROPERTIES  DEPENDS "CPP_ex_h5tutr_crtatt" FIXTURES_REQUIRED "clear_cppex_tutr" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;74;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_h5tutr_crtgrp "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_h5tutr_crtgrp" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_h5tutr_crtgrp.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_h5tutr_crtgrp PROPERTIES  DEPENDS "CPP_ex_h5tutr_crtgrpar" FIXTURES_REQUIRED "clear_cppex_tutr" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;74;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_h5tutr_crtgrpd "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_h5tutr_crtgrpd" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_h5tutr_crtgrpd.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_h5tutr_crtgrpd PROPERTIES  DEPENDS "CPP_ex_h5tutr_crtgrp" FIXTURES_REQUIRED "clear_cppex_tutr" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;74;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_h5tutr_extend "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_h5tutr_extend" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_h5tutr_extend.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_h5tutr_extend PROPERTIES  DEPENDS "CPP_ex_h5tutr_crtgrpd" FIXTURES_REQUIRED "clear_cppex_tutr" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;74;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_h5tutr_rdwt "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_h5tutr_rdwt" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_h5tutr_rdwt.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_h5tutr_rdwt PROPERTIES  DEPENDS "CPP_ex_h5tutr_extend" FIXTURES_REQUIRED "clear_cppex_tutr" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;74;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
+add_test(CPP_ex_h5tutr_subset "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_ex_h5tutr_subset" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_ex_h5tutr_subset.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_ex_h5tutr_subset PROPERTIES  DEPENDS "CPP_ex_h5tutr_rdwt" FIXTURES_REQUIRED "clear_cppex_tutr" _BACKTRACE_TRIPLES "/root/repo/c++/examples/CMakeTests.cmake;74;add_test;/root/repo/c++/examples/CMakeTests.cmake;0;;/root/repo/c++/examples/CMakeLists.txt;86;include;/root/repo/c++/examples/CMakeLists.txt;0;")
@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/c++/src/H5AbstractDs.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5AbstractDs.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5AbstractDs.cpp.o.d"
+  "/root/repo/c++/src/H5ArrayType.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5ArrayType.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5ArrayType.cpp.o.d"
+  "/root/repo/c++/src/H5AtomType.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5AtomType.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5AtomType.cpp.o.d"
+  "/root/repo/c++/src/H5Attribute.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5Attribute.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5Attribute.cpp.o.d"
+  "/root/repo/c++/src/H5CommonFG.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5CommonFG.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5CommonFG.cpp.o.d"
+  "/root/repo/c++/src/H5CompType.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5CompType.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5CompType.cpp.o.d"
+  "/root/repo/c++/src/H5DaccProp.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5DaccProp.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5DaccProp.cpp.o.d"
+  "/root/repo/c++/src/H5DataSet.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5DataSet.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5DataSet.cpp.o.d"
+  "/root/repo/c++/src/H5DataSpace.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5DataSpace.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5DataSpace.cpp.o.d"
+  "/root/repo/c++/src/H5DataType.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5DataType.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5DataType.cpp.o.d"
+  "/root/repo/c++/src/H5DcreatProp.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5DcreatProp.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5DcreatProp.cpp.o.d"
+  "/root/repo/c++/src/H5DxferProp.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5DxferProp.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5DxferProp.cpp.o.d"
+  "/root/repo/c++/src/H5EnumType.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5EnumType.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5EnumType.cpp.o.d"
+  "/root/repo/c++/src/H5Exception.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5Exception.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5Exception.cpp.o.d"
+  "/root/repo/c++/src/H5FaccProp.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5FaccProp.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5FaccProp.cpp.o.d"
+  "/root/repo/c++/src/H5FcreatProp.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5FcreatProp.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5FcreatProp.cpp.o.d"
+  "/root/repo/c++/src/H5File.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5File.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5File.cpp.o.d"
+  "/root/repo/c++/src/H5FloatType.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5FloatType.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5FloatType.cpp.o.d"
+  "/root/repo/c++/src/H5Group.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5Group.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5Group.cpp.o.d"
+  "/root/repo/c++/src/H5IdComponent.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5IdComponent.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5IdComponent.cpp.o.d"
+  "/root/repo/c++/src/H5IntType.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5IntType.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5IntType.cpp.o.d"
+  "/root/repo/c++/src/H5LaccProp.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5LaccProp.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5LaccProp.cpp.o.d"
+  "/root/repo/c++/src/H5LcreatProp.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5LcreatProp.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5LcreatProp.cpp.o.d"
+  "/root/repo/c++/src/H5Library.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5Library.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5Library.cpp.o.d"
+  "/root/repo/c++/src/H5Location.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5Location.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5Location.cpp.o.d"
+  "/root/repo/c++/src/H5Object.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5Object.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5Object.cpp.o.d"
+  "/root/repo/c++/src/H5OcreatProp.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5OcreatProp.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5OcreatProp.cpp.o.d"
+  "/root/repo/c++/src/H5PredType.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5PredType.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5PredType.cpp.o.d"
+  "/root/repo/c++/src/H5PropList.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5PropList.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5PropList.cpp.o.d"
+  "/root/repo/c++/src/H5StrType.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5StrType.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5StrType.cpp.o.d"
+  "/root/repo/c++/src/H5VarLenType.cpp" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5VarLenType.cpp.o" "gcc" "c++/src/CMakeFiles/hdf5_cpp-static.dir/H5VarLenType.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_map_build/src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
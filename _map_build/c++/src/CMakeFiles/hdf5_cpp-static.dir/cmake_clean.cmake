@@ -0,0 +1,71 @@
+file(REMOVE_RECURSE
+  "../../bin/libhdf5_cpp_debug.a"
+  "../../bin/libhdf5_cpp_debug.pdb"
+  "CMakeFiles/hdf5_cpp-static.dir/H5AbstractDs.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5AbstractDs.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5ArrayType.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5ArrayType.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5AtomType.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5AtomType.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5Attribute.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5Attribute.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5CommonFG.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5CommonFG.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5CompType.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5CompType.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5DaccProp.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5DaccProp.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5DataSet.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5DataSet.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5DataSpace.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5DataSpace.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5DataType.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5DataType.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5DcreatProp.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5DcreatProp.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5DxferProp.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5DxferProp.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5EnumType.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5EnumType.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5Exception.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5Exception.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5FaccProp.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5FaccProp.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5FcreatProp.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5FcreatProp.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5File.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5File.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5FloatType.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5FloatType.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5Group.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5Group.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5IdComponent.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5IdComponent.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5IntType.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5IntType.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5LaccProp.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5LaccProp.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5LcreatProp.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5LcreatProp.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5Library.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5Library.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5Location.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5Location.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5Object.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5Object.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5OcreatProp.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5OcreatProp.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5PredType.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5PredType.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5PropList.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5PropList.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5StrType.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5StrType.cpp.o.d"
+  "CMakeFiles/hdf5_cpp-static.dir/H5VarLenType.cpp.o"
+  "CMakeFiles/hdf5_cpp-static.dir/H5VarLenType.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hdf5_cpp-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
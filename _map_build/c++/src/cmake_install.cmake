@@ -0,0 +1,97 @@
+# Install script for directory: /root/repo/c++/src
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local/HDF_Group/HDF5/1.13.0")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "cppheaders" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include" TYPE FILE FILES
+    "/root/repo/c++/src/H5AbstractDs.h"
+    "/root/repo/c++/src/H5Alltypes.h"
+    "/root/repo/c++/src/H5ArrayType.h"
+    "/root/repo/c++/src/H5AtomType.h"
+    "/root/repo/c++/src/H5Attribute.h"
+    "/root/repo/c++/src/H5Classes.h"
+    "/root/repo/c++/src/H5CommonFG.h"
+    "/root/repo/c++/src/H5CompType.h"
+    "/root/repo/c++/src/H5Cpp.h"
+    "/root/repo/c++/src/H5CppDoc.h"
+    "/root/repo/c++/src/H5DataSet.h"
+    "/root/repo/c++/src/H5DataSpace.h"
+    "/root/repo/c++/src/H5DataType.h"
+    "/root/repo/c++/src/H5DaccProp.h"
+    "/root/repo/c++/src/H5DcreatProp.h"
+    "/root/repo/c++/src/H5DxferProp.h"
+    "/root/repo/c++/src/H5EnumType.h"
+    "/root/repo/c++/src/H5Exception.h"
+    "/root/repo/c++/src/H5FaccProp.h"
+    "/root/repo/c++/src/H5FcreatProp.h"
+    "/root/repo/c++/src/H5File.h"
+    "/root/repo/c++/src/H5FloatType.h"
+    "/root/repo/c++/src/H5Group.h"
+    "/root/repo/c++/src/H5IdComponent.h"
+    "/root/repo/c++/src/H5Include.h"
+    "/root/repo/c++/src/H5IntType.h"
+    "/root/repo/c++/src/H5LaccProp.h"
+    "/root/repo/c++/src/H5LcreatProp.h"
+    "/root/repo/c++/src/H5Library.h"
+    "/root/repo/c++/src/H5Location.h"
+    "/root/repo/c++/src/H5Object.h"
+    "/root/repo/c++/src/H5OcreatProp.h"
+    "/root/repo/c++/src/H5PredType.h"
+    "/root/repo/c++/src/H5PropList.h"
+    "/root/repo/c++/src/H5StrType.h"
+    "/root/repo/c++/src/H5VarLenType.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "cpplibraries" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_map_build/bin/libhdf5_cpp_debug.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "cpplibraries" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/pkgconfig" TYPE FILE FILES "/root/repo/_map_build/CMakeFiles/hdf5_cpp-1.13.0.pc")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "cpplibraries" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/bin" TYPE FILE PERMISSIONS OWNER_READ OWNER_WRITE OWNER_EXECUTE GROUP_READ GROUP_EXECUTE WORLD_READ WORLD_EXECUTE FILES "/root/repo/_map_build/CMakeFiles/h5c++")
+endif()
+
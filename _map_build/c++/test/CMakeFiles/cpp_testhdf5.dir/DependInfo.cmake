@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/c++/test/dsets.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/dsets.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/dsets.cpp.o.d"
+  "/root/repo/c++/test/h5cpputil.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/h5cpputil.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/h5cpputil.cpp.o.d"
+  "/root/repo/c++/test/tarray.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/tarray.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/tarray.cpp.o.d"
+  "/root/repo/c++/test/tattr.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/tattr.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/tattr.cpp.o.d"
+  "/root/repo/c++/test/tcompound.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/tcompound.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/tcompound.cpp.o.d"
+  "/root/repo/c++/test/tdspl.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/tdspl.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/tdspl.cpp.o.d"
+  "/root/repo/c++/test/testhdf5.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/testhdf5.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/testhdf5.cpp.o.d"
+  "/root/repo/c++/test/tfile.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/tfile.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/tfile.cpp.o.d"
+  "/root/repo/c++/test/tfilter.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/tfilter.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/tfilter.cpp.o.d"
+  "/root/repo/c++/test/th5s.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/th5s.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/th5s.cpp.o.d"
+  "/root/repo/c++/test/titerate.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/titerate.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/titerate.cpp.o.d"
+  "/root/repo/c++/test/tlinks.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/tlinks.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/tlinks.cpp.o.d"
+  "/root/repo/c++/test/tobject.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/tobject.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/tobject.cpp.o.d"
+  "/root/repo/c++/test/trefer.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/trefer.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/trefer.cpp.o.d"
+  "/root/repo/c++/test/ttypes.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/ttypes.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/ttypes.cpp.o.d"
+  "/root/repo/c++/test/tvlstr.cpp" "c++/test/CMakeFiles/cpp_testhdf5.dir/tvlstr.cpp.o" "gcc" "c++/test/CMakeFiles/cpp_testhdf5.dir/tvlstr.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_map_build/c++/src/CMakeFiles/hdf5_cpp-static.dir/DependInfo.cmake"
+  "/root/repo/_map_build/src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  "/root/repo/_map_build/test/CMakeFiles/hdf5_test-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/c++/test
+# Build directory: /root/repo/_map_build/c++/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CPP_testhdf5-clear-objects "/usr/bin/cmake" "-E" "remove" "tattr_basic.h5" "tattr_compound.h5" "tattr_dtype.h5" "tattr_multi.h5" "tattr_scalar.h5" "tfattrs.h5" "titerate.h5")
+set_tests_properties(CPP_testhdf5-clear-objects PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/c++/test/CMakeTests.cmake;21;add_test;/root/repo/c++/test/CMakeTests.cmake;0;;/root/repo/c++/test/CMakeLists.txt;68;include;/root/repo/c++/test/CMakeLists.txt;0;")
+add_test(CPP_testhdf5 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cpp_testhdf5" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cpp_testhdf5.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/c++/test" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(CPP_testhdf5 PROPERTIES  DEPENDS "CPP_testhdf5-clear-objects" _BACKTRACE_TRIPLES "/root/repo/c++/test/CMakeTests.cmake;37;add_test;/root/repo/c++/test/CMakeTests.cmake;0;;/root/repo/c++/test/CMakeLists.txt;68;include;/root/repo/c++/test/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_attribute"
+  "../bin/h5_attribute.pdb"
+  "CMakeFiles/h5_attribute.dir/h5_attribute.c.o"
+  "CMakeFiles/h5_attribute.dir/h5_attribute.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_attribute.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_cmprss"
+  "../bin/h5_cmprss.pdb"
+  "CMakeFiles/h5_cmprss.dir/h5_cmprss.c.o"
+  "CMakeFiles/h5_cmprss.dir/h5_cmprss.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_cmprss.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
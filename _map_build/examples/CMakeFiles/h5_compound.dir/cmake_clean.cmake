@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_compound"
+  "../bin/h5_compound.pdb"
+  "CMakeFiles/h5_compound.dir/h5_compound.c.o"
+  "CMakeFiles/h5_compound.dir/h5_compound.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_compound.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_crtatt"
+  "../bin/h5_crtatt.pdb"
+  "CMakeFiles/h5_crtatt.dir/h5_crtatt.c.o"
+  "CMakeFiles/h5_crtatt.dir/h5_crtatt.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_crtatt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
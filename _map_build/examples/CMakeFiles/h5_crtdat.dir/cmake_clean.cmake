@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_crtdat"
+  "../bin/h5_crtdat.pdb"
+  "CMakeFiles/h5_crtdat.dir/h5_crtdat.c.o"
+  "CMakeFiles/h5_crtdat.dir/h5_crtdat.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_crtdat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
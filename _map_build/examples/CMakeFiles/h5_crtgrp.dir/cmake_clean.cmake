@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_crtgrp"
+  "../bin/h5_crtgrp.pdb"
+  "CMakeFiles/h5_crtgrp.dir/h5_crtgrp.c.o"
+  "CMakeFiles/h5_crtgrp.dir/h5_crtgrp.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_crtgrp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
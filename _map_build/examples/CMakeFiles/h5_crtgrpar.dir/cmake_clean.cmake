@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_crtgrpar"
+  "../bin/h5_crtgrpar.pdb"
+  "CMakeFiles/h5_crtgrpar.dir/h5_crtgrpar.c.o"
+  "CMakeFiles/h5_crtgrpar.dir/h5_crtgrpar.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_crtgrpar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_crtgrpd"
+  "../bin/h5_crtgrpd.pdb"
+  "CMakeFiles/h5_crtgrpd.dir/h5_crtgrpd.c.o"
+  "CMakeFiles/h5_crtgrpd.dir/h5_crtgrpd.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_crtgrpd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_debug_trace"
+  "../bin/h5_debug_trace.pdb"
+  "CMakeFiles/h5_debug_trace.dir/h5_debug_trace.c.o"
+  "CMakeFiles/h5_debug_trace.dir/h5_debug_trace.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_debug_trace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
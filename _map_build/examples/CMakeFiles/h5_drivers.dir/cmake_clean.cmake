@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_drivers"
+  "../bin/h5_drivers.pdb"
+  "CMakeFiles/h5_drivers.dir/h5_drivers.c.o"
+  "CMakeFiles/h5_drivers.dir/h5_drivers.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_drivers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
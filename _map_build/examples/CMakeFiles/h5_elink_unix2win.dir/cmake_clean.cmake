@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_elink_unix2win"
+  "../bin/h5_elink_unix2win.pdb"
+  "CMakeFiles/h5_elink_unix2win.dir/h5_elink_unix2win.c.o"
+  "CMakeFiles/h5_elink_unix2win.dir/h5_elink_unix2win.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_elink_unix2win.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_extend"
+  "../bin/h5_extend.pdb"
+  "CMakeFiles/h5_extend.dir/h5_extend.c.o"
+  "CMakeFiles/h5_extend.dir/h5_extend.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_extend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_extend_write"
+  "../bin/h5_extend_write.pdb"
+  "CMakeFiles/h5_extend_write.dir/h5_extend_write.c.o"
+  "CMakeFiles/h5_extend_write.dir/h5_extend_write.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_extend_write.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_extlink"
+  "../bin/h5_extlink.pdb"
+  "CMakeFiles/h5_extlink.dir/h5_extlink.c.o"
+  "CMakeFiles/h5_extlink.dir/h5_extlink.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_extlink.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_group"
+  "../bin/h5_group.pdb"
+  "CMakeFiles/h5_group.dir/h5_group.c.o"
+  "CMakeFiles/h5_group.dir/h5_group.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_group.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_mount"
+  "../bin/h5_mount.pdb"
+  "CMakeFiles/h5_mount.dir/h5_mount.c.o"
+  "CMakeFiles/h5_mount.dir/h5_mount.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_mount.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
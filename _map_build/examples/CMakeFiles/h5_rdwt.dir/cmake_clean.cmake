@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_rdwt"
+  "../bin/h5_rdwt.pdb"
+  "CMakeFiles/h5_rdwt.dir/h5_rdwt.c.o"
+  "CMakeFiles/h5_rdwt.dir/h5_rdwt.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_rdwt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
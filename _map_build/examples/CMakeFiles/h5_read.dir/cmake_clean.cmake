@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_read"
+  "../bin/h5_read.pdb"
+  "CMakeFiles/h5_read.dir/h5_read.c.o"
+  "CMakeFiles/h5_read.dir/h5_read.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_read.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_ref_compat"
+  "../bin/h5_ref_compat.pdb"
+  "CMakeFiles/h5_ref_compat.dir/h5_ref_compat.c.o"
+  "CMakeFiles/h5_ref_compat.dir/h5_ref_compat.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_ref_compat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
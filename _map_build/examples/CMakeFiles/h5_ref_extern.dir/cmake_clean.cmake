@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_ref_extern"
+  "../bin/h5_ref_extern.pdb"
+  "CMakeFiles/h5_ref_extern.dir/h5_ref_extern.c.o"
+  "CMakeFiles/h5_ref_extern.dir/h5_ref_extern.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_ref_extern.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_reference_deprec"
+  "../bin/h5_reference_deprec.pdb"
+  "CMakeFiles/h5_reference_deprec.dir/h5_reference_deprec.c.o"
+  "CMakeFiles/h5_reference_deprec.dir/h5_reference_deprec.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_reference_deprec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_select"
+  "../bin/h5_select.pdb"
+  "CMakeFiles/h5_select.dir/h5_select.c.o"
+  "CMakeFiles/h5_select.dir/h5_select.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_select.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
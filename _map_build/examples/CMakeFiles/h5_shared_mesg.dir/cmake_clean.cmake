@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_shared_mesg"
+  "../bin/h5_shared_mesg.pdb"
+  "CMakeFiles/h5_shared_mesg.dir/h5_shared_mesg.c.o"
+  "CMakeFiles/h5_shared_mesg.dir/h5_shared_mesg.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_shared_mesg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_subset"
+  "../bin/h5_subset.pdb"
+  "CMakeFiles/h5_subset.dir/h5_subset.c.o"
+  "CMakeFiles/h5_subset.dir/h5_subset.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_subset.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_vds-eiger"
+  "../bin/h5_vds-eiger.pdb"
+  "CMakeFiles/h5_vds-eiger.dir/h5_vds-eiger.c.o"
+  "CMakeFiles/h5_vds-eiger.dir/h5_vds-eiger.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_vds-eiger.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
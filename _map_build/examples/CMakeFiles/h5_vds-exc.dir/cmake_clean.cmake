@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_vds-exc"
+  "../bin/h5_vds-exc.pdb"
+  "CMakeFiles/h5_vds-exc.dir/h5_vds-exc.c.o"
+  "CMakeFiles/h5_vds-exc.dir/h5_vds-exc.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_vds-exc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
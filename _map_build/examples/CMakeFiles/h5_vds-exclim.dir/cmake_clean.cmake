@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_vds-exclim"
+  "../bin/h5_vds-exclim.pdb"
+  "CMakeFiles/h5_vds-exclim.dir/h5_vds-exclim.c.o"
+  "CMakeFiles/h5_vds-exclim.dir/h5_vds-exclim.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_vds-exclim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_vds-percival-unlim-maxmin"
+  "../bin/h5_vds-percival-unlim-maxmin.pdb"
+  "CMakeFiles/h5_vds-percival-unlim-maxmin.dir/h5_vds-percival-unlim-maxmin.c.o"
+  "CMakeFiles/h5_vds-percival-unlim-maxmin.dir/h5_vds-percival-unlim-maxmin.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_vds-percival-unlim-maxmin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
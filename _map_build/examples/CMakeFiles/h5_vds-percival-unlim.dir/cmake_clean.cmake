@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_vds-percival-unlim"
+  "../bin/h5_vds-percival-unlim.pdb"
+  "CMakeFiles/h5_vds-percival-unlim.dir/h5_vds-percival-unlim.c.o"
+  "CMakeFiles/h5_vds-percival-unlim.dir/h5_vds-percival-unlim.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_vds-percival-unlim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_vds-percival"
+  "../bin/h5_vds-percival.pdb"
+  "CMakeFiles/h5_vds-percival.dir/h5_vds-percival.c.o"
+  "CMakeFiles/h5_vds-percival.dir/h5_vds-percival.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_vds-percival.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
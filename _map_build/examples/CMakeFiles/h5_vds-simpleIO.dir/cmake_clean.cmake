@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_vds-simpleIO"
+  "../bin/h5_vds-simpleIO.pdb"
+  "CMakeFiles/h5_vds-simpleIO.dir/h5_vds-simpleIO.c.o"
+  "CMakeFiles/h5_vds-simpleIO.dir/h5_vds-simpleIO.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_vds-simpleIO.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
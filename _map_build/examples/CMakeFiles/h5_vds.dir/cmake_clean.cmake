@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/h5_vds"
+  "../bin/h5_vds.pdb"
+  "CMakeFiles/h5_vds.dir/h5_vds.c.o"
+  "CMakeFiles/h5_vds.dir/h5_vds.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5_vds.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,78 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples
+# Build directory: /root/repo/_map_build/examples
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(EXAMPLES-clear-objects "/usr/bin/cmake" "-E" "remove" "Attributes.h5" "btrees_file.h5" "cmprss.h5" "default_file.h5" "dset.h5" "extend.h5" "extlink_prefix_source.h5" "extlink_source.h5" "extlink_target.h5" "group.h5" "groups.h5" "hard_link.h5" "mount1.h5" "mount2.h5" "one_index_file.h5" "only_dspaces_and_attrs_file.h5" "only_huge_mesgs_file.h5" "REF_REG.h5" "refere.h5" "SDS.h5" "SDScompound.h5" "SDSextendible.h5" "Select.h5" "separate_indexes_file.h5" "small_lists_file.h5" "soft_link.h5" "subset.h5" "unix2win.h5" "blue/prefix_target.h5" "red/prefix_target.h5" "u2w/u2w_target.h5" "vds.h5" "vds-exc.h5" "vds-excalibur.h5" "vds-exclim.h5" "vds-percival.h5" "vds-percival-unlim.h5" "vds-percival-unlim-maxmin.h5" "a.h5" "b.h5" "c.h5" "d.h5" "vds-simpleIO.h5" "vds-eiger.h5")
+set_tests_properties(EXAMPLES-clear-objects PROPERTIES  FIXTURES_SETUP "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;69;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_crtdat "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_crtdat" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_crtdat.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_crtdat PROPERTIES  FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_rdwt "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_rdwt" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_rdwt.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_rdwt PROPERTIES  DEPENDS "EXAMPLES-h5_crtdat" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_crtatt "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_crtatt" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_crtatt.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_crtatt PROPERTIES  DEPENDS "EXAMPLES-h5_rdwt" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_crtgrp "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_crtgrp" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_crtgrp.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_crtgrp PROPERTIES  DEPENDS "EXAMPLES-h5_crtatt" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_crtgrpar "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_crtgrpar" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_crtgrpar.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_crtgrpar PROPERTIES  DEPENDS "EXAMPLES-h5_crtgrp" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_crtgrpd "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_crtgrpd" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_crtgrpd.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_crtgrpd PROPERTIES  DEPENDS "EXAMPLES-h5_crtgrpar" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_cmprss "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_cmprss" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_cmprss.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_cmprss PROPERTIES  DEPENDS "EXAMPLES-h5_crtgrpd" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_extend "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_extend" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_extend.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_extend PROPERTIES  DEPENDS "EXAMPLES-h5_cmprss" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_subset "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_subset" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_subset.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_subset PROPERTIES  DEPENDS "EXAMPLES-h5_extend" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_write "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_write" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_write.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_write PROPERTIES  DEPENDS "EXAMPLES-h5_subset" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_read "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_read" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_read.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_read PROPERTIES  DEPENDS "EXAMPLES-h5_write" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_extend_write "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_extend_write" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_extend_write.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_extend_write PROPERTIES  DEPENDS "EXAMPLES-h5_read" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_chunk_read "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_chunk_read" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_chunk_read.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_chunk_read PROPERTIES  DEPENDS "EXAMPLES-h5_extend_write" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_compound "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_compound" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_compound.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_compound PROPERTIES  DEPENDS "EXAMPLES-h5_chunk_read" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_group "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_group" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_group.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_group PROPERTIES  DEPENDS "EXAMPLES-h5_compound" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_select "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_select" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_select.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_select PROPERTIES  DEPENDS "EXAMPLES-h5_group" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_attribute "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_attribute" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_attribute.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_attribute PROPERTIES  DEPENDS "EXAMPLES-h5_select" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_mount "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_mount" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_mount.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_mount PROPERTIES  DEPENDS "EXAMPLES-h5_attribute" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_ref_extern "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_ref_extern" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_ref_extern.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_ref_extern PROPERTIES  DEPENDS "EXAMPLES-h5_mount" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_ref_compat "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_ref_compat" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_ref_compat.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_ref_compat PROPERTIES  DEPENDS "EXAMPLES-h5_ref_extern" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_reference_deprec "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_reference_deprec" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_reference_deprec.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_reference_deprec PROPERTIES  DEPENDS "EXAMPLES-h5_ref_compat" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_drivers "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_drivers" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_drivers.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_drivers PROPERTIES  DEPENDS "EXAMPLES-h5_reference_deprec" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_ref2reg_deprec "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_ref2reg_deprec" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_ref2reg_deprec.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_ref2reg_deprec PROPERTIES  DEPENDS "EXAMPLES-h5_drivers" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_extlink "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_extlink" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_extlink.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_extlink PROPERTIES  DEPENDS "EXAMPLES-h5_ref2reg_deprec" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_elink_unix2win "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_elink_unix2win" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_elink_unix2win.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_elink_unix2win PROPERTIES  DEPENDS "EXAMPLES-h5_extlink" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_shared_mesg "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_shared_mesg" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_shared_mesg.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_shared_mesg PROPERTIES  DEPENDS "EXAMPLES-h5_elink_unix2win" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_debug_trace "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_debug_trace" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_debug_trace.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_debug_trace PROPERTIES  DEPENDS "EXAMPLES-h5_shared_mesg" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_vds "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_vds" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_vds.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_vds PROPERTIES  DEPENDS "EXAMPLES-h5_debug_trace" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_vds-exc "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_vds-exc" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_vds-exc.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_vds-exc PROPERTIES  DEPENDS "EXAMPLES-h5_vds" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_vds-exclim "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_vds-exclim" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_vds-exclim.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_vds-exclim PROPERTIES  DEPENDS "EXAMPLES-h5_vds-exc" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_vds-eiger "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_vds-eiger" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_vds-eiger.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_vds-eiger PROPERTIES  DEPENDS "EXAMPLES-h5_vds-exclim" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_vds-simpleIO "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_vds-simpleIO" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_vds-simpleIO.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_vds-simpleIO PROPERTIES  DEPENDS "EXAMPLES-h5_vds-eiger" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_vds-percival "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_vds-percival" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_vds-percival.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_vds-percival PROPERTIES  DEPENDS "EXAMPLES-h5_vds-simpleIO" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_vds-percival-unlim "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_vds-percival-unlim" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_vds-percival-unlim.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_vds-percival-unlim PROPERTIES  DEPENDS "EXAMPLES-h5_vds-percival" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
+add_test(EXAMPLES-h5_vds-percival-unlim-maxmin "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/h5_vds-percival-unlim-maxmin" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=h5_vds-percival-unlim-maxmin.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(EXAMPLES-h5_vds-percival-unlim-maxmin PROPERTIES  DEPENDS "EXAMPLES-h5_vds-percival-unlim" FIXTURES_REQUIRED "clear_EXAMPLES" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeTests.cmake;79;add_test;/root/repo/examples/CMakeTests.cmake;0;;/root/repo/examples/CMakeLists.txt;86;include;/root/repo/examples/CMakeLists.txt;0;")
@@ -0,0 +1,133 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS hdf5-static hdf5_hl-static hdf5_cpp-static hdf5_hl_cpp-static mirror_server mirror_server_stop)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Create imported target hdf5-static
+add_library(hdf5-static STATIC IMPORTED)
+
+set_target_properties(hdf5-static PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "_POSIX_C_SOURCE=200809L;_GNU_SOURCE"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_map_build/src;/root/repo/_map_build/src;/root/repo/src"
+  INTERFACE_LINK_LIBRARIES "\$<LINK_ONLY:m>;\$<LINK_ONLY:dl>;\$<LINK_ONLY:\$<\$<BOOL:OFF>:>>;\$<\$<NOT:\$<PLATFORM_ID:Windows>>:dl>;\$<LINK_ONLY:\$<\$<BOOL:OFF>:Threads::Threads>>"
+)
+
+# Create imported target hdf5_hl-static
+add_library(hdf5_hl-static STATIC IMPORTED)
+
+set_target_properties(hdf5_hl-static PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_map_build/hl/src;/root/repo/hl/src"
+  INTERFACE_LINK_LIBRARIES "hdf5-static"
+)
+
+# Create imported target hdf5_cpp-static
+add_library(hdf5_cpp-static STATIC IMPORTED)
+
+set_target_properties(hdf5_cpp-static PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_map_build/c++/src;/root/repo/c++/src"
+  INTERFACE_LINK_LIBRARIES "hdf5-static"
+)
+
+# Create imported target hdf5_hl_cpp-static
+add_library(hdf5_hl_cpp-static STATIC IMPORTED)
+
+set_target_properties(hdf5_hl_cpp-static PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_map_build/hl/c++/src;/root/repo/hl/c++/src"
+  INTERFACE_LINK_LIBRARIES "hdf5_hl-static;hdf5-static"
+)
+
+# Create imported target mirror_server
+add_executable(mirror_server IMPORTED)
+
+# Create imported target mirror_server_stop
+add_executable(mirror_server_stop IMPORTED)
+
+# Import target "hdf5-static" for configuration "Debug"
+set_property(TARGET hdf5-static APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(hdf5-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "C"
+  IMPORTED_LOCATION_DEBUG "/root/repo/_map_build/bin/libhdf5_debug.a"
+  )
+
+# Import target "hdf5_hl-static" for configuration "Debug"
+set_property(TARGET hdf5_hl-static APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(hdf5_hl-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "C"
+  IMPORTED_LOCATION_DEBUG "/root/repo/_map_build/bin/libhdf5_hl_debug.a"
+  )
+
+# Import target "hdf5_cpp-static" for configuration "Debug"
+set_property(TARGET hdf5_cpp-static APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(hdf5_cpp-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "/root/repo/_map_build/bin/libhdf5_cpp_debug.a"
+  )
+
+# Import target "hdf5_hl_cpp-static" for configuration "Debug"
+set_property(TARGET hdf5_hl_cpp-static APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(hdf5_hl_cpp-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "/root/repo/_map_build/bin/libhdf5_hl_cpp_debug.a"
+  )
+
+# Import target "mirror_server" for configuration "Debug"
+set_property(TARGET mirror_server APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(mirror_server PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_map_build/bin/mirror_server"
+  )
+
+# Import target "mirror_server_stop" for configuration "Debug"
+set_property(TARGET mirror_server_stop APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(mirror_server_stop PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_map_build/bin/mirror_server_stop"
+  )
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/hl/c++
+# Build directory: /root/repo/_map_build/hl/c++
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("src")
+subdirs("examples")
+subdirs("test")
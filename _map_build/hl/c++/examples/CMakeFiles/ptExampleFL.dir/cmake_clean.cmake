@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/ptExampleFL"
+  "../../../bin/ptExampleFL.pdb"
+  "CMakeFiles/ptExampleFL.dir/ptExampleFL.cpp.o"
+  "CMakeFiles/ptExampleFL.dir/ptExampleFL.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ptExampleFL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
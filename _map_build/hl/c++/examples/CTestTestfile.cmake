@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/hl/c++/examples
+# Build directory: /root/repo/_map_build/hl/c++/examples
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(HL_CPP_ex_ptExampleFL-clear-objects "/usr/bin/cmake" "-E" "remove" "PTcppexampleFL.h5" "ptExampleFL.txt")
+set_tests_properties(HL_CPP_ex_ptExampleFL-clear-objects PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/hl/c++/examples/CMakeTests.cmake;19;add_test;/root/repo/hl/c++/examples/CMakeTests.cmake;0;;/root/repo/hl/c++/examples/CMakeLists.txt;34;include;/root/repo/hl/c++/examples/CMakeLists.txt;0;")
+add_test(HL_CPP_ex_ptExampleFL "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/ptExampleFL" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=ptExampleFL.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/c++/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_CPP_ex_ptExampleFL PROPERTIES  DEPENDS "HL_CPP_ex_ptExampleFL-clear-objects" _BACKTRACE_TRIPLES "/root/repo/hl/c++/examples/CMakeTests.cmake;30;add_test;/root/repo/hl/c++/examples/CMakeTests.cmake;0;;/root/repo/hl/c++/examples/CMakeLists.txt;34;include;/root/repo/hl/c++/examples/CMakeLists.txt;0;")
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/hl/c++/test/ptableTest.cpp" "hl/c++/test/CMakeFiles/hl_ptableTest.dir/ptableTest.cpp.o" "gcc" "hl/c++/test/CMakeFiles/hl_ptableTest.dir/ptableTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_map_build/src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  "/root/repo/_map_build/test/CMakeFiles/hdf5_test-static.dir/DependInfo.cmake"
+  "/root/repo/_map_build/c++/src/CMakeFiles/hdf5_cpp-static.dir/DependInfo.cmake"
+  "/root/repo/_map_build/hl/src/CMakeFiles/hdf5_hl-static.dir/DependInfo.cmake"
+  "/root/repo/_map_build/hl/c++/src/CMakeFiles/hdf5_hl_cpp-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
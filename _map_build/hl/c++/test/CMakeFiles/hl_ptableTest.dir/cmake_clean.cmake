@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/hl_ptableTest"
+  "../../../bin/hl_ptableTest.pdb"
+  "CMakeFiles/hl_ptableTest.dir/ptableTest.cpp.o"
+  "CMakeFiles/hl_ptableTest.dir/ptableTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hl_ptableTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
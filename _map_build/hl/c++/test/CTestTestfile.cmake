@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/hl/c++/test
+# Build directory: /root/repo/_map_build/hl/c++/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(HL_CPP_ptableTest-clear-objects "/usr/bin/cmake" "-E" "remove" ".txt")
+set_tests_properties(HL_CPP_ptableTest-clear-objects PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/hl/c++/test/CMakeTests.cmake;19;add_test;/root/repo/hl/c++/test/CMakeTests.cmake;0;;/root/repo/hl/c++/test/CMakeLists.txt;36;include;/root/repo/hl/c++/test/CMakeLists.txt;0;")
+add_test(HL_CPP_ptableTest "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ptableTest" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ptableTest.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/c++/test" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_CPP_ptableTest PROPERTIES  DEPENDS "HL_CPP_ptableTest-clear-objects" _BACKTRACE_TRIPLES "/root/repo/hl/c++/test/CMakeTests.cmake;27;add_test;/root/repo/hl/c++/test/CMakeTests.cmake;0;;/root/repo/hl/c++/test/CMakeLists.txt;36;include;/root/repo/hl/c++/test/CMakeLists.txt;0;")
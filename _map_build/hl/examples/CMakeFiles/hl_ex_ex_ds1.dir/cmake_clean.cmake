@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hl_ex_ex_ds1"
+  "../../bin/hl_ex_ex_ds1.pdb"
+  "CMakeFiles/hl_ex_ex_ds1.dir/ex_ds1.c.o"
+  "CMakeFiles/hl_ex_ex_ds1.dir/ex_ds1.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hl_ex_ex_ds1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hl_ex_ex_ds1_files"
+  "image24pixel.txt"
+  "image8.txt"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/hl_ex_ex_ds1_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hl_ex_ptExampleFL"
+  "../../bin/hl_ex_ptExampleFL.pdb"
+  "CMakeFiles/hl_ex_ptExampleFL.dir/ptExampleFL.c.o"
+  "CMakeFiles/hl_ex_ptExampleFL.dir/ptExampleFL.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hl_ex_ptExampleFL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
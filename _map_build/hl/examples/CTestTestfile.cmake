@@ -0,0 +1,46 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/hl/examples
+# Build directory: /root/repo/_map_build/hl/examples
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(HL_ex-clear-objects "/usr/bin/cmake" "-E" "remove" "ex_lite1.h5" "ex_lite2.h5" "ex_lite3.h5" "packet_table_FLexample.h5" "ex_image1.h5" "ex_image2.h5" "ex_table_01.h5" "ex_table_02.h5" "ex_table_03.h5" "ex_table_04.h5" "ex_table_05.h5" "ex_table_06.h5" "ex_table_07.h5" "ex_table_08.h5" "ex_table_09.h5" "ex_table_10.h5" "ex_table_11.h5" "ex_table_12.h5" "ex_ds1.h5")
+set_tests_properties(HL_ex-clear-objects PROPERTIES  FIXTURES_SETUP "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;30;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_lite1 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_lite1" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_lite1.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_lite1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_lite2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_lite2" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_lite2.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_lite2 PROPERTIES  DEPENDS "HL_ex_ex_lite1" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_lite3 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_lite3" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_lite3.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_lite3 PROPERTIES  DEPENDS "HL_ex_ex_lite2" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ptExampleFL "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ptExampleFL" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ptExampleFL.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ptExampleFL PROPERTIES  DEPENDS "HL_ex_ex_lite3" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_image1 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_image1" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_image1.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_image1 PROPERTIES  DEPENDS "HL_ex_ptExampleFL" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_image2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_image2" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_image2.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_image2 PROPERTIES  DEPENDS "HL_ex_ex_image1" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_table_01 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_table_01" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_table_01.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_table_01 PROPERTIES  DEPENDS "HL_ex_ex_image2" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_table_02 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_table_02" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_table_02.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_table_02 PROPERTIES  DEPENDS "HL_ex_ex_table_01" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_table_03 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_table_03" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_table_03.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_table_03 PROPERTIES  DEPENDS "HL_ex_ex_table_02" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_table_04 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_table_04" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_table_04.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_table_04 PROPERTIES  DEPENDS "HL_ex_ex_table_03" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_table_05 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_table_05" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_table_05.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_table_05 PROPERTIES  DEPENDS "HL_ex_ex_table_04" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_table_06 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_table_06" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_table_06.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_table_06 PROPERTIES  DEPENDS "HL_ex_ex_table_05" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_table_07 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_table_07" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_table_07.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_table_07 PROPERTIES  DEPENDS "HL_ex_ex_table_06" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_table_08 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_table_08" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_table_08.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_table_08 PROPERTIES  DEPENDS "HL_ex_ex_table_07" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_table_09 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_table_09" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_table_09.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_table_09 PROPERTIES  DEPENDS "HL_ex_ex_table_08" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_table_10 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_table_10" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_table_10.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_table_10 PROPERTIES  DEPENDS "HL_ex_ex_table_09" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_table_11 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_table_11" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_table_11.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_table_11 PROPERTIES  DEPENDS "HL_ex_ex_table_10" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_table_12 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_table_12" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_table_12.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_table_12 PROPERTIES  DEPENDS "HL_ex_ex_table_11" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
+add_test(HL_ex_ex_ds1 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_ex_ex_ds1" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_ex_ex_ds1.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/examples" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_ex_ex_ds1 PROPERTIES  DEPENDS "HL_ex_ex_table_12" FIXTURES_REQUIRED "clear_HL_ex" _BACKTRACE_TRIPLES "/root/repo/hl/examples/CMakeTests.cmake;60;add_test;/root/repo/hl/examples/CMakeTests.cmake;0;;/root/repo/hl/examples/CMakeLists.txt;50;include;/root/repo/hl/examples/CMakeLists.txt;0;")
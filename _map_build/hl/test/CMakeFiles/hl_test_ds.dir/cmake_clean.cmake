@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hl_test_ds"
+  "../../bin/hl_test_ds.pdb"
+  "CMakeFiles/hl_test_ds.dir/test_ds.c.o"
+  "CMakeFiles/hl_test_ds.dir/test_ds.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hl_test_ds.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
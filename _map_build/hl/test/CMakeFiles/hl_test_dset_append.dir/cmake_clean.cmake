@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hl_test_dset_append"
+  "../../bin/hl_test_dset_append.pdb"
+  "CMakeFiles/hl_test_dset_append.dir/test_dset_append.c.o"
+  "CMakeFiles/hl_test_dset_append.dir/test_dset_append.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hl_test_dset_append.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
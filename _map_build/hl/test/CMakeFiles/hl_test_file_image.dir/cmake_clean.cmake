@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hl_test_file_image"
+  "../../bin/hl_test_file_image.pdb"
+  "CMakeFiles/hl_test_file_image.dir/test_file_image.c.o"
+  "CMakeFiles/hl_test_file_image.dir/test_file_image.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hl_test_file_image.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hl_test_ld"
+  "../../bin/hl_test_ld.pdb"
+  "CMakeFiles/hl_test_ld.dir/test_ld.c.o"
+  "CMakeFiles/hl_test_ld.dir/test_ld.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hl_test_ld.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hl_test_lite"
+  "../../bin/hl_test_lite.pdb"
+  "CMakeFiles/hl_test_lite.dir/test_lite.c.o"
+  "CMakeFiles/hl_test_lite.dir/test_lite.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hl_test_lite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
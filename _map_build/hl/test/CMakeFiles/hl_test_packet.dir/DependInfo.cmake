@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/hl/test/test_packet.c" "hl/test/CMakeFiles/hl_test_packet.dir/test_packet.c.o" "gcc" "hl/test/CMakeFiles/hl_test_packet.dir/test_packet.c.o.d"
+  "/root/repo/hl/test/test_packet_vlen.c" "hl/test/CMakeFiles/hl_test_packet.dir/test_packet_vlen.c.o" "gcc" "hl/test/CMakeFiles/hl_test_packet.dir/test_packet_vlen.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_map_build/hl/src/CMakeFiles/hdf5_hl-static.dir/DependInfo.cmake"
+  "/root/repo/_map_build/test/CMakeFiles/hdf5_test-static.dir/DependInfo.cmake"
+  "/root/repo/_map_build/src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/hl_test_packet"
+  "../../bin/hl_test_packet.pdb"
+  "CMakeFiles/hl_test_packet.dir/test_packet.c.o"
+  "CMakeFiles/hl_test_packet.dir/test_packet.c.o.d"
+  "CMakeFiles/hl_test_packet.dir/test_packet_vlen.c.o"
+  "CMakeFiles/hl_test_packet.dir/test_packet_vlen.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hl_test_packet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hl_test_table"
+  "../../bin/hl_test_table.pdb"
+  "CMakeFiles/hl_test_table.dir/test_table.c.o"
+  "CMakeFiles/hl_test_table.dir/test_table.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hl_test_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/hl/test
+# Build directory: /root/repo/_map_build/hl/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(HL_test-clear-objects "/usr/bin/cmake" "-E" "remove" "combine_tables1.h5" "combine_tables2.h5" "file_img1.h5" "file_img2.h5" "test_append.h5" "h5do_compat.h5" "test_detach.h5" "test_ds1.h5" "test_ds2.h5" "test_ds3.h5" "test_ds4.h5" "test_ds5.h5" "test_ds6.h5" "test_ds7.h5" "test_ds8.h5" "test_ds9.h5" "test_ds10.h5" "test_image1.h5" "test_image2.h5" "test_image3.h5" "test_lite1.h5" "test_lite2.h5" "test_lite3.h5" "test_lite4.h5" "test_packet_compress.h5" "test_packet_table.h5" "test_packet_table_vlen.h5" "testfl_packet_table_vlen.h5" "test_table.h5")
+set_tests_properties(HL_test-clear-objects PROPERTIES  FIXTURES_SETUP "clear_test_hl" _BACKTRACE_TRIPLES "/root/repo/hl/test/CMakeTests.cmake;78;add_test;/root/repo/hl/test/CMakeTests.cmake;0;;/root/repo/hl/test/CMakeLists.txt;129;include;/root/repo/hl/test/CMakeLists.txt;0;")
+add_test(HL_test_lite "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_test_lite" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_test_lite.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/test" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_test_lite PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/hl/test" FIXTURES_REQUIRED "clear_test_hl" WORKING_DIRECTORY "/root/repo/_map_build/hl/test" _BACKTRACE_TRIPLES "/root/repo/hl/test/CMakeTests.cmake;91;add_test;/root/repo/hl/test/CMakeTests.cmake;110;HL_add_test;/root/repo/hl/test/CMakeTests.cmake;0;;/root/repo/hl/test/CMakeLists.txt;129;include;/root/repo/hl/test/CMakeLists.txt;0;")
+add_test(HL_test_image "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_test_image" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_test_image.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/test" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_test_image PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/hl/test" FIXTURES_REQUIRED "clear_test_hl" WORKING_DIRECTORY "/root/repo/_map_build/hl/test" _BACKTRACE_TRIPLES "/root/repo/hl/test/CMakeTests.cmake;91;add_test;/root/repo/hl/test/CMakeTests.cmake;111;HL_add_test;/root/repo/hl/test/CMakeTests.cmake;0;;/root/repo/hl/test/CMakeLists.txt;129;include;/root/repo/hl/test/CMakeLists.txt;0;")
+add_test(HL_test_file_image "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_test_file_image" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_test_file_image.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/test" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_test_file_image PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/hl/test" FIXTURES_REQUIRED "clear_test_hl" WORKING_DIRECTORY "/root/repo/_map_build/hl/test" _BACKTRACE_TRIPLES "/root/repo/hl/test/CMakeTests.cmake;91;add_test;/root/repo/hl/test/CMakeTests.cmake;112;HL_add_test;/root/repo/hl/test/CMakeTests.cmake;0;;/root/repo/hl/test/CMakeLists.txt;129;include;/root/repo/hl/test/CMakeLists.txt;0;")
+add_test(HL_test_table "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_test_table" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_test_table.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/test" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_test_table PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/hl/test" FIXTURES_REQUIRED "clear_test_hl" WORKING_DIRECTORY "/root/repo/_map_build/hl/test" _BACKTRACE_TRIPLES "/root/repo/hl/test/CMakeTests.cmake;91;add_test;/root/repo/hl/test/CMakeTests.cmake;113;HL_add_test;/root/repo/hl/test/CMakeTests.cmake;0;;/root/repo/hl/test/CMakeLists.txt;129;include;/root/repo/hl/test/CMakeLists.txt;0;")
+add_test(HL_test_ds "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_test_ds" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_test_ds.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/test" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_test_ds PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/hl/test" FIXTURES_REQUIRED "clear_test_hl" WORKING_DIRECTORY "/root/repo/_map_build/hl/test" _BACKTRACE_TRIPLES "/root/repo/hl/test/CMakeTests.cmake;91;add_test;/root/repo/hl/test/CMakeTests.cmake;114;HL_add_test;/root/repo/hl/test/CMakeTests.cmake;0;;/root/repo/hl/test/CMakeLists.txt;129;include;/root/repo/hl/test/CMakeLists.txt;0;")
+add_test(HL_test_packet "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_test_packet" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_test_packet.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/test" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_test_packet PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/hl/test" FIXTURES_REQUIRED "clear_test_hl" WORKING_DIRECTORY "/root/repo/_map_build/hl/test" _BACKTRACE_TRIPLES "/root/repo/hl/test/CMakeTests.cmake;91;add_test;/root/repo/hl/test/CMakeTests.cmake;115;HL_add_test;/root/repo/hl/test/CMakeTests.cmake;0;;/root/repo/hl/test/CMakeLists.txt;129;include;/root/repo/hl/test/CMakeLists.txt;0;")
+add_test(HL_test_ld "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_test_ld" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_test_ld.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/test" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_test_ld PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/hl/test" FIXTURES_REQUIRED "clear_test_hl" WORKING_DIRECTORY "/root/repo/_map_build/hl/test" _BACKTRACE_TRIPLES "/root/repo/hl/test/CMakeTests.cmake;91;add_test;/root/repo/hl/test/CMakeTests.cmake;116;HL_add_test;/root/repo/hl/test/CMakeTests.cmake;0;;/root/repo/hl/test/CMakeLists.txt;129;include;/root/repo/hl/test/CMakeLists.txt;0;")
+add_test(HL_test_dset_append "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_test_dset_append" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_test_dset_append.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/test" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_test_dset_append PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/hl/test" FIXTURES_REQUIRED "clear_test_hl" WORKING_DIRECTORY "/root/repo/_map_build/hl/test" _BACKTRACE_TRIPLES "/root/repo/hl/test/CMakeTests.cmake;91;add_test;/root/repo/hl/test/CMakeTests.cmake;117;HL_add_test;/root/repo/hl/test/CMakeTests.cmake;0;;/root/repo/hl/test/CMakeLists.txt;129;include;/root/repo/hl/test/CMakeLists.txt;0;")
+add_test(HL_test_h5do_compat "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hl_test_h5do_compat" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hl_test_h5do_compat.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/hl/test" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(HL_test_h5do_compat PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/hl/test" FIXTURES_REQUIRED "clear_test_hl" WORKING_DIRECTORY "/root/repo/_map_build/hl/test" _BACKTRACE_TRIPLES "/root/repo/hl/test/CMakeTests.cmake;91;add_test;/root/repo/hl/test/CMakeTests.cmake;118;HL_add_test;/root/repo/hl/test/CMakeTests.cmake;0;;/root/repo/hl/test/CMakeLists.txt;129;include;/root/repo/hl/test/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/H5detect"
+  "../bin/H5detect.pdb"
+  "CMakeFiles/H5detect.dir/H5detect.c.o"
+  "CMakeFiles/H5detect.dir/H5detect.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/H5detect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gen_hdf5-static"
+  "H5lib_settings.c"
+  "gen_SRCS.stamp1"
+  "gen_SRCS.stamp2"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/gen_hdf5-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
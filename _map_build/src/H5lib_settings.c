@@ -0,0 +1,125 @@
+/* Generated automatically by H5make_libsettings -- do not edit */
+
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Created:		Oct 16, 2026
+ *			root <root@vm>
+ *
+ * Purpose:		This machine-generated source code contains
+ *			information about the library build configuration
+ *
+ * Modifications:
+ *
+ *	DO NOT MAKE MODIFICATIONS TO THIS FILE!
+ *	It was generated by code in `H5make_libsettings.c'.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+char H5libhdf5_settings[]=
+	"        SUMMARY OF THE HDF5 CONFIGURATION\n"
+	"        =================================\n"
+	"\n"
+	"General Information:\n"
+	"-------------------\n"
+	"                   HDF5 Version: 1.13.0\n"
+	"                  Configured on: 2026-10-16\n"
+	"                  Configured by: Unix Makefiles\n"
+	"                    Host system: Linux-6.18.44-fc-v130\n"
+	"              Uname information: Linux\n"
+	"                       Byte sex: little-endian\n"
+	"             Installation point: /usr/local/HDF_Group/HDF5/1.13.0\n"
+	"\n"
+	"Compiling Options:\n"
+	"------------------\n"
+	"                     Build Mode: Debug\n"
+	"              Debugging Symbols: OFF\n"
+	"                        Asserts: OFF\n"
+	"                      Profiling: OFF\n"
+	"             Optimization Level: OFF\n"
+	"\n"
+	"Linking Options:\n"
+	"----------------\n"
+	"                      Libraries: \n"
+	"  Statically Linked Executables: OFF\n"
+	"                        LDFLAGS: \n"
+	"                     H5_LDFLAGS: \n"
+	"                     AM_LDFLAGS: \n"
+	"                Extra libraries: m;dl\n"
+	"                       Archiver: /usr/bin/ar\n"
+	"                         Ranlib: /usr/bin/ranlib\n"
+	"\n"
+	"Languages:\n"
+	"----------\n"
+	"                              C: YES\n"
+	"                     C Compiler: /usr/bin/cc 12.2.0\n"
+	"                       CPPFLAGS: \n"
+	"                    H5_CPPFLAGS: \n"
+	"                    AM_CPPFLAGS: \n"
+	"                         CFLAGS:   -std=c99  -Og -ftrapv -fno-common -fmessage-length=0\n"
+	"                      H5_CFLAGS: -Wall;-Wcast-qual;-Wconversion;-Wextra;-Wfloat-equal;-Wformat=2;-Winit-self;-Winvalid-pch;-Wmissing-include-dirs;-Wno-c++-compat;-Wno-format-nonliteral;-Wshadow;-Wundef;-Wwrite-strings;-pedantic\n"
+	"                      AM_CFLAGS: \n"
+	"               Shared C Library: NO\n"
+	"               Static C Library: YES\n"
+	"\n"
+	"                        Fortran: OFF\n"
+	"               Fortran Compiler:  \n"
+	"                  Fortran Flags: \n"
+	"               H5 Fortran Flags: \n"
+	"               AM Fortran Flags: \n"
+	"         Shared Fortran Library: NO\n"
+	"         Static Fortran Library: YES\n"
+	"\n"
+	"                            C++: ON\n"
+	"                   C++ Compiler: /usr/bin/c++ 12.2.0\n"
+	"                      C++ Flags:     -Og -ftrapv -fno-common -fmessage-length=0\n"
+	"                   H5 C++ Flags: -Wall;-Wcast-qual;-Wconversion;-Wctor-dtor-privacy;-Weffc++;-Wextra;-Wfloat-equal;-Wformat=2;-Winit-self;-Winvalid-pch;-Wmissing-include-dirs;-Wno-format-nonliteral;-Wnon-virtual-dtor;-Wold-style-cast;-Woverloaded-virtual;-Wreorder;-Wshadow;-Wsign-promo;-Wundef;-Wwrite-strings;-pedantic\n"
+	"                   AM C++ Flags: \n"
+	"             Shared C++ Library: NO\n"
+	"             Static C++ Library: YES\n"
+	"\n"
+	"                            JAVA: OFF\n"
+	"                 JAVA Compiler:  \n"
+	"\n"
+	"Features:\n"
+	"---------\n"
+	"                   Parallel HDF5: OFF\n"
+	"Parallel Filtered Dataset Writes: \n"
+	"              Large Parallel I/O: \n"
+	"              High-level library: ON\n"
+	"                Build HDF5 Tests: ON\n"
+	"                Build HDF5 Tools: OFF\n"
+	"                    Threadsafety: OFF\n"
+	"             Default API mapping: v114\n"
+	"  With deprecated public symbols: ON\n"
+	"          I/O filters (external): \n"
+	"                             MPE: \n"
+	"                      Direct VFD: \n"
+	"                    io_uring VFD: \n"
+	"                      Mirror VFD: \n"
+	"              (Read-Only) S3 VFD: \n"
+	"            (Read-Only) HDFS VFD: \n"
+	"                         dmalloc: \n"
+	"  Packages w/ extra debug output: \n"
+	"                     API Tracing: OFF\n"
+	"            Using memory checker: OFF\n"
+	"     B+-trees for internal lists: OFF\n"
+	" Memory allocation sanity checks: OFF\n"
+	"          Function Stack Tracing: OFF\n"
+	"                Use file locking: best-effort\n"
+	"       Strict File Format Checks: OFF\n"
+	"    Optimization Instrumentation: \n"
+;
+
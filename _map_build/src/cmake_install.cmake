@@ -0,0 +1,112 @@
+# Install script for directory: /root/repo/src
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local/HDF_Group/HDF5/1.13.0")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include" TYPE FILE FILES
+    "/root/repo/src/hdf5.h"
+    "/root/repo/src/H5api_adpt.h"
+    "/root/repo/src/H5public.h"
+    "/root/repo/src/H5Apublic.h"
+    "/root/repo/src/H5ACpublic.h"
+    "/root/repo/src/H5Cpublic.h"
+    "/root/repo/src/H5Dpublic.h"
+    "/root/repo/src/H5Epubgen.h"
+    "/root/repo/src/H5Epublic.h"
+    "/root/repo/src/H5ESpublic.h"
+    "/root/repo/src/H5Fpublic.h"
+    "/root/repo/src/H5FDcore.h"
+    "/root/repo/src/H5FDdirect.h"
+    "/root/repo/src/H5FDfamily.h"
+    "/root/repo/src/H5FDhdfs.h"
+    "/root/repo/src/H5FDiouring.h"
+    "/root/repo/src/H5FDlog.h"
+    "/root/repo/src/H5FDmirror.h"
+    "/root/repo/src/H5FDmpi.h"
+    "/root/repo/src/H5FDmpio.h"
+    "/root/repo/src/H5FDmulti.h"
+    "/root/repo/src/H5FDpublic.h"
+    "/root/repo/src/H5FDros3.h"
+    "/root/repo/src/H5FDs3comms.h"
+    "/root/repo/src/H5FDsec2.h"
+    "/root/repo/src/H5FDsplitter.h"
+    "/root/repo/src/H5FDstdio.h"
+    "/root/repo/src/H5FDwindows.h"
+    "/root/repo/src/H5Gpublic.h"
+    "/root/repo/src/H5Ipublic.h"
+    "/root/repo/src/H5Lpublic.h"
+    "/root/repo/src/H5Mpublic.h"
+    "/root/repo/src/H5MMpublic.h"
+    "/root/repo/src/H5Opublic.h"
+    "/root/repo/src/H5Ppublic.h"
+    "/root/repo/src/H5PLextern.h"
+    "/root/repo/src/H5PLpublic.h"
+    "/root/repo/src/H5Rpublic.h"
+    "/root/repo/src/H5Spublic.h"
+    "/root/repo/src/H5Tpublic.h"
+    "/root/repo/src/H5TSpublic.h"
+    "/root/repo/src/H5VLconnector.h"
+    "/root/repo/src/H5VLconnector_passthru.h"
+    "/root/repo/src/H5VLnative.h"
+    "/root/repo/src/H5VLpassthru.h"
+    "/root/repo/src/H5VLpublic.h"
+    "/root/repo/src/H5Zpublic.h"
+    "/root/repo/src/H5Epubgen.h"
+    "/root/repo/src/H5version.h"
+    "/root/repo/src/H5overflow.h"
+    "/root/repo/_map_build/src/H5pubconf.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "libraries" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_map_build/bin/libhdf5_debug.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "libraries" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/pkgconfig" TYPE FILE FILES "/root/repo/_map_build/CMakeFiles/hdf5-1.13.0.pc")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "libraries" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/bin" TYPE FILE PERMISSIONS OWNER_READ OWNER_WRITE OWNER_EXECUTE GROUP_READ GROUP_EXECUTE WORLD_READ WORLD_EXECUTE FILES "/root/repo/_map_build/CMakeFiles/h5cc")
+endif()
+
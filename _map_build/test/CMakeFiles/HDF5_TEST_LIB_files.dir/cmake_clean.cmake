@@ -0,0 +1,161 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HDF5_TEST_LIB_files"
+  "H5TEST/aggr.h5"
+  "H5TEST/bad_compound.h5"
+  "H5TEST/bad_offset.h5"
+  "H5TEST/be_data.h5"
+  "H5TEST/be_extlink1.h5"
+  "H5TEST/be_extlink2.h5"
+  "H5TEST/btree_idx_1_6.h5"
+  "H5TEST/btree_idx_1_8.h5"
+  "H5TEST/corrupt_stab_msg.h5"
+  "H5TEST/deflate.h5"
+  "H5TEST/err_compat_1"
+  "H5TEST/err_compat_2"
+  "H5TEST/error_test_1"
+  "H5TEST/error_test_2"
+  "H5TEST/family_v16_00000.h5"
+  "H5TEST/family_v16_00001.h5"
+  "H5TEST/family_v16_00002.h5"
+  "H5TEST/family_v16_00003.h5"
+  "H5TEST/file_image_core_test.h5"
+  "H5TEST/filespace_1_6.h5"
+  "H5TEST/filespace_1_8.h5"
+  "H5TEST/fill18.h5"
+  "H5TEST/fill_old.h5"
+  "H5TEST/filter_error.h5"
+  "H5TEST/fsm_aggr_nopersist.h5"
+  "H5TEST/fsm_aggr_persist.h5"
+  "H5TEST/group_old.h5"
+  "H5TEST/h5fc_ext1_f.h5"
+  "H5TEST/h5fc_ext1_i.h5"
+  "H5TEST/h5fc_ext2_if.h5"
+  "H5TEST/h5fc_ext2_sf.h5"
+  "H5TEST/h5fc_ext3_isf.h5"
+  "H5TEST/h5fc_ext_none.h5"
+  "H5TEST/le_data.h5"
+  "H5TEST/le_extlink1.h5"
+  "H5TEST/le_extlink2.h5"
+  "H5TEST/links_env.out"
+  "H5TEST/memleak_H5O_dtype_decode_helper_H5Odtype.h5"
+  "H5TEST/mergemsg.h5"
+  "H5TEST/multi_file_v16-r.h5"
+  "H5TEST/multi_file_v16-s.h5"
+  "H5TEST/noencoder.h5"
+  "H5TEST/none.h5"
+  "H5TEST/paged_nopersist.h5"
+  "H5TEST/paged_persist.h5"
+  "H5TEST/specmetaread.h5"
+  "H5TEST/tarrold.h5"
+  "H5TEST/tbad_msg_count.h5"
+  "H5TEST/tbogus.h5"
+  "H5TEST/test_filters_be.h5"
+  "H5TEST/test_filters_le.h5"
+  "H5TEST/testfiles/plist_files/acpl_32be"
+  "H5TEST/testfiles/plist_files/acpl_32le"
+  "H5TEST/testfiles/plist_files/acpl_64be"
+  "H5TEST/testfiles/plist_files/acpl_64le"
+  "H5TEST/testfiles/plist_files/dapl_32be"
+  "H5TEST/testfiles/plist_files/dapl_32le"
+  "H5TEST/testfiles/plist_files/dapl_64be"
+  "H5TEST/testfiles/plist_files/dapl_64le"
+  "H5TEST/testfiles/plist_files/dcpl_32be"
+  "H5TEST/testfiles/plist_files/dcpl_32le"
+  "H5TEST/testfiles/plist_files/dcpl_64be"
+  "H5TEST/testfiles/plist_files/dcpl_64le"
+  "H5TEST/testfiles/plist_files/def_acpl_32be"
+  "H5TEST/testfiles/plist_files/def_acpl_32le"
+  "H5TEST/testfiles/plist_files/def_acpl_64be"
+  "H5TEST/testfiles/plist_files/def_acpl_64le"
+  "H5TEST/testfiles/plist_files/def_dapl_32be"
+  "H5TEST/testfiles/plist_files/def_dapl_32le"
+  "H5TEST/testfiles/plist_files/def_dapl_64be"
+  "H5TEST/testfiles/plist_files/def_dapl_64le"
+  "H5TEST/testfiles/plist_files/def_dcpl_32be"
+  "H5TEST/testfiles/plist_files/def_dcpl_32le"
+  "H5TEST/testfiles/plist_files/def_dcpl_64be"
+  "H5TEST/testfiles/plist_files/def_dcpl_64le"
+  "H5TEST/testfiles/plist_files/def_dxpl_32be"
+  "H5TEST/testfiles/plist_files/def_dxpl_32le"
+  "H5TEST/testfiles/plist_files/def_dxpl_64be"
+  "H5TEST/testfiles/plist_files/def_dxpl_64le"
+  "H5TEST/testfiles/plist_files/def_fapl_32be"
+  "H5TEST/testfiles/plist_files/def_fapl_32le"
+  "H5TEST/testfiles/plist_files/def_fapl_64be"
+  "H5TEST/testfiles/plist_files/def_fapl_64le"
+  "H5TEST/testfiles/plist_files/def_fcpl_32be"
+  "H5TEST/testfiles/plist_files/def_fcpl_32le"
+  "H5TEST/testfiles/plist_files/def_fcpl_64be"
+  "H5TEST/testfiles/plist_files/def_fcpl_64le"
+  "H5TEST/testfiles/plist_files/def_gcpl_32be"
+  "H5TEST/testfiles/plist_files/def_gcpl_32le"
+  "H5TEST/testfiles/plist_files/def_gcpl_64be"
+  "H5TEST/testfiles/plist_files/def_gcpl_64le"
+  "H5TEST/testfiles/plist_files/def_lapl_32be"
+  "H5TEST/testfiles/plist_files/def_lapl_32le"
+  "H5TEST/testfiles/plist_files/def_lapl_64be"
+  "H5TEST/testfiles/plist_files/def_lapl_64le"
+  "H5TEST/testfiles/plist_files/def_lcpl_32be"
+  "H5TEST/testfiles/plist_files/def_lcpl_32le"
+  "H5TEST/testfiles/plist_files/def_lcpl_64be"
+  "H5TEST/testfiles/plist_files/def_lcpl_64le"
+  "H5TEST/testfiles/plist_files/def_ocpl_32be"
+  "H5TEST/testfiles/plist_files/def_ocpl_32le"
+  "H5TEST/testfiles/plist_files/def_ocpl_64be"
+  "H5TEST/testfiles/plist_files/def_ocpl_64le"
+  "H5TEST/testfiles/plist_files/def_ocpypl_32be"
+  "H5TEST/testfiles/plist_files/def_ocpypl_32le"
+  "H5TEST/testfiles/plist_files/def_ocpypl_64be"
+  "H5TEST/testfiles/plist_files/def_ocpypl_64le"
+  "H5TEST/testfiles/plist_files/def_strcpl_32be"
+  "H5TEST/testfiles/plist_files/def_strcpl_32le"
+  "H5TEST/testfiles/plist_files/def_strcpl_64be"
+  "H5TEST/testfiles/plist_files/def_strcpl_64le"
+  "H5TEST/testfiles/plist_files/dxpl_32be"
+  "H5TEST/testfiles/plist_files/dxpl_32le"
+  "H5TEST/testfiles/plist_files/dxpl_64be"
+  "H5TEST/testfiles/plist_files/dxpl_64le"
+  "H5TEST/testfiles/plist_files/fapl_32be"
+  "H5TEST/testfiles/plist_files/fapl_32le"
+  "H5TEST/testfiles/plist_files/fapl_64be"
+  "H5TEST/testfiles/plist_files/fapl_64le"
+  "H5TEST/testfiles/plist_files/fcpl_32be"
+  "H5TEST/testfiles/plist_files/fcpl_32le"
+  "H5TEST/testfiles/plist_files/fcpl_64be"
+  "H5TEST/testfiles/plist_files/fcpl_64le"
+  "H5TEST/testfiles/plist_files/gcpl_32be"
+  "H5TEST/testfiles/plist_files/gcpl_32le"
+  "H5TEST/testfiles/plist_files/gcpl_64be"
+  "H5TEST/testfiles/plist_files/gcpl_64le"
+  "H5TEST/testfiles/plist_files/lapl_32be"
+  "H5TEST/testfiles/plist_files/lapl_32le"
+  "H5TEST/testfiles/plist_files/lapl_64be"
+  "H5TEST/testfiles/plist_files/lapl_64le"
+  "H5TEST/testfiles/plist_files/lcpl_32be"
+  "H5TEST/testfiles/plist_files/lcpl_32le"
+  "H5TEST/testfiles/plist_files/lcpl_64be"
+  "H5TEST/testfiles/plist_files/lcpl_64le"
+  "H5TEST/testfiles/plist_files/ocpl_32be"
+  "H5TEST/testfiles/plist_files/ocpl_32le"
+  "H5TEST/testfiles/plist_files/ocpl_64be"
+  "H5TEST/testfiles/plist_files/ocpl_64le"
+  "H5TEST/testfiles/plist_files/ocpypl_32be"
+  "H5TEST/testfiles/plist_files/ocpypl_32le"
+  "H5TEST/testfiles/plist_files/ocpypl_64be"
+  "H5TEST/testfiles/plist_files/ocpypl_64le"
+  "H5TEST/testfiles/plist_files/strcpl_32be"
+  "H5TEST/testfiles/plist_files/strcpl_32le"
+  "H5TEST/testfiles/plist_files/strcpl_64be"
+  "H5TEST/testfiles/plist_files/strcpl_64le"
+  "H5TEST/th5s.h5"
+  "H5TEST/tlayouto.h5"
+  "H5TEST/tmtimen.h5"
+  "H5TEST/tmtimeo.h5"
+  "H5TEST/tnullspace.h5"
+  "H5TEST/tsizeslheap.h5"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/HDF5_TEST_LIB_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/accum_swmr_reader"
+  "../bin/accum_swmr_reader.pdb"
+  "CMakeFiles/accum_swmr_reader.dir/accum_swmr_reader.c.o"
+  "CMakeFiles/accum_swmr_reader.dir/accum_swmr_reader.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/accum_swmr_reader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
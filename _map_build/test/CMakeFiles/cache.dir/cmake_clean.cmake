@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cache"
+  "../bin/cache.pdb"
+  "CMakeFiles/cache.dir/cache.c.o"
+  "CMakeFiles/cache.dir/cache.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
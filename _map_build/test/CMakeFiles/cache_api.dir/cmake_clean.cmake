@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cache_api"
+  "../bin/cache_api.pdb"
+  "CMakeFiles/cache_api.dir/cache_api.c.o"
+  "CMakeFiles/cache_api.dir/cache_api.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cache_api.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/cache_image"
+  "../bin/cache_image.pdb"
+  "CMakeFiles/cache_image.dir/cache_image.c.o"
+  "CMakeFiles/cache_image.dir/cache_image.c.o.d"
+  "CMakeFiles/cache_image.dir/genall5.c.o"
+  "CMakeFiles/cache_image.dir/genall5.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cache_image.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cache_logging"
+  "../bin/cache_logging.pdb"
+  "CMakeFiles/cache_logging.dir/cache_logging.c.o"
+  "CMakeFiles/cache_logging.dir/cache_logging.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cache_logging.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/chunk_info"
+  "../bin/chunk_info.pdb"
+  "CMakeFiles/chunk_info.dir/chunk_info.c.o"
+  "CMakeFiles/chunk_info.dir/chunk_info.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/chunk_info.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cmpd_dtransform"
+  "../bin/cmpd_dtransform.pdb"
+  "CMakeFiles/cmpd_dtransform.dir/cmpd_dtransform.c.o"
+  "CMakeFiles/cmpd_dtransform.dir/cmpd_dtransform.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmpd_dtransform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
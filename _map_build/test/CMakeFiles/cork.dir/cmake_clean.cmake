@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cork"
+  "../bin/cork.pdb"
+  "CMakeFiles/cork.dir/cork.c.o"
+  "CMakeFiles/cork.dir/cork.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cork.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
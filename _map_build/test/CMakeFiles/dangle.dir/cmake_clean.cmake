@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/dangle"
+  "../bin/dangle.pdb"
+  "CMakeFiles/dangle.dir/dangle.c.o"
+  "CMakeFiles/dangle.dir/dangle.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dangle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/del_many_dense_attrs"
+  "../bin/del_many_dense_attrs.pdb"
+  "CMakeFiles/del_many_dense_attrs.dir/del_many_dense_attrs.c.o"
+  "CMakeFiles/del_many_dense_attrs.dir/del_many_dense_attrs.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/del_many_dense_attrs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/direct_chunk"
+  "../bin/direct_chunk.pdb"
+  "CMakeFiles/direct_chunk.dir/direct_chunk.c.o"
+  "CMakeFiles/direct_chunk.dir/direct_chunk.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/direct_chunk.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/enum"
+  "../bin/enum.pdb"
+  "CMakeFiles/enum.dir/enum.c.o"
+  "CMakeFiles/enum.dir/enum.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/enum.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/event_set"
+  "../bin/event_set.pdb"
+  "CMakeFiles/event_set.dir/event_set.c.o"
+  "CMakeFiles/event_set.dir/event_set.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/event_set.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/extend"
+  "../bin/extend.pdb"
+  "CMakeFiles/extend.dir/extend.c.o"
+  "CMakeFiles/extend.dir/extend.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/extend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/external_env"
+  "../bin/external_env.pdb"
+  "CMakeFiles/external_env.dir/external_env.c.o"
+  "CMakeFiles/external_env.dir/external_env.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/external_env.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
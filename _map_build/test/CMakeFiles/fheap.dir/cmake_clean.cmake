@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/fheap"
+  "../bin/fheap.pdb"
+  "CMakeFiles/fheap.dir/fheap.c.o"
+  "CMakeFiles/fheap.dir/fheap.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/fheap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
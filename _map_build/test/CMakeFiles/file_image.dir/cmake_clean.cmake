@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/file_image"
+  "../bin/file_image.pdb"
+  "CMakeFiles/file_image.dir/file_image.c.o"
+  "CMakeFiles/file_image.dir/file_image.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/file_image.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
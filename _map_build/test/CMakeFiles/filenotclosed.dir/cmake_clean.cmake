@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/filenotclosed"
+  "../bin/filenotclosed.pdb"
+  "CMakeFiles/filenotclosed.dir/filenotclosed.c.o"
+  "CMakeFiles/filenotclosed.dir/filenotclosed.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/filenotclosed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
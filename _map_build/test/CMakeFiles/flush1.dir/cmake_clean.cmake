@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/flush1"
+  "../bin/flush1.pdb"
+  "CMakeFiles/flush1.dir/flush1.c.o"
+  "CMakeFiles/flush1.dir/flush1.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/flush1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/flush2"
+  "../bin/flush2.pdb"
+  "CMakeFiles/flush2.dir/flush2.c.o"
+  "CMakeFiles/flush2.dir/flush2.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/flush2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
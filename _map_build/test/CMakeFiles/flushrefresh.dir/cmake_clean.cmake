@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/flushrefresh"
+  "../bin/flushrefresh.pdb"
+  "CMakeFiles/flushrefresh.dir/flushrefresh.c.o"
+  "CMakeFiles/flushrefresh.dir/flushrefresh.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/flushrefresh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/getname"
+  "../bin/getname.pdb"
+  "CMakeFiles/getname.dir/getname.c.o"
+  "CMakeFiles/getname.dir/getname.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/getname.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/gheap"
+  "../bin/gheap.pdb"
+  "CMakeFiles/gheap.dir/gheap.c.o"
+  "CMakeFiles/gheap.dir/gheap.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/gheap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../bin/libhdf5_test_debug.a"
+  "../bin/libhdf5_test_debug.pdb"
+  "CMakeFiles/hdf5_test-static.dir/cache_common.c.o"
+  "CMakeFiles/hdf5_test-static.dir/cache_common.c.o.d"
+  "CMakeFiles/hdf5_test-static.dir/external_common.c.o"
+  "CMakeFiles/hdf5_test-static.dir/external_common.c.o.d"
+  "CMakeFiles/hdf5_test-static.dir/h5test.c.o"
+  "CMakeFiles/hdf5_test-static.dir/h5test.c.o.d"
+  "CMakeFiles/hdf5_test-static.dir/swmr_common.c.o"
+  "CMakeFiles/hdf5_test-static.dir/swmr_common.c.o.d"
+  "CMakeFiles/hdf5_test-static.dir/testframe.c.o"
+  "CMakeFiles/hdf5_test-static.dir/testframe.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf5_test-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
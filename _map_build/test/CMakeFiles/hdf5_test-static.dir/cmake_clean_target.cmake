@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "../bin/libhdf5_test_debug.a"
+)
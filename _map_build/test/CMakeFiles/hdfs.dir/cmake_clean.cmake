@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/hdfs"
+  "../bin/hdfs.pdb"
+  "CMakeFiles/hdfs.dir/hdfs.c.o"
+  "CMakeFiles/hdfs.dir/hdfs.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdfs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/hyperslab"
+  "../bin/hyperslab.pdb"
+  "CMakeFiles/hyperslab.dir/hyperslab.c.o"
+  "CMakeFiles/hyperslab.dir/hyperslab.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hyperslab.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
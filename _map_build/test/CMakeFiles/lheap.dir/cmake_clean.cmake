@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/lheap"
+  "../bin/lheap.pdb"
+  "CMakeFiles/lheap.dir/lheap.c.o"
+  "CMakeFiles/lheap.dir/lheap.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lheap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/links"
+  "../bin/links.pdb"
+  "CMakeFiles/links.dir/links.c.o"
+  "CMakeFiles/links.dir/links.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/links.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
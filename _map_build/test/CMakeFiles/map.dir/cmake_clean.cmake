@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/map"
+  "../bin/map.pdb"
+  "CMakeFiles/map.dir/map.c.o"
+  "CMakeFiles/map.dir/map.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/map.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
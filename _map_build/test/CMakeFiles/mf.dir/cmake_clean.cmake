@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/mf"
+  "../bin/mf.pdb"
+  "CMakeFiles/mf.dir/mf.c.o"
+  "CMakeFiles/mf.dir/mf.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
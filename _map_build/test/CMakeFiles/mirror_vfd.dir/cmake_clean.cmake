@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/mirror_vfd"
+  "../bin/mirror_vfd.pdb"
+  "CMakeFiles/mirror_vfd.dir/genall5.c.o"
+  "CMakeFiles/mirror_vfd.dir/genall5.c.o.d"
+  "CMakeFiles/mirror_vfd.dir/mirror_vfd.c.o"
+  "CMakeFiles/mirror_vfd.dir/mirror_vfd.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mirror_vfd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
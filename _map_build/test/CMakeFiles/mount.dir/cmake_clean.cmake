@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/mount"
+  "../bin/mount.pdb"
+  "CMakeFiles/mount.dir/mount.c.o"
+  "CMakeFiles/mount.dir/mount.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mount.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/ntypes"
+  "../bin/ntypes.pdb"
+  "CMakeFiles/ntypes.dir/ntypes.c.o"
+  "CMakeFiles/ntypes.dir/ntypes.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ntypes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
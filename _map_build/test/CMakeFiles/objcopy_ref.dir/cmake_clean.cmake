@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/objcopy_ref"
+  "../bin/objcopy_ref.pdb"
+  "CMakeFiles/objcopy_ref.dir/objcopy_ref.c.o"
+  "CMakeFiles/objcopy_ref.dir/objcopy_ref.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/objcopy_ref.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/page_buffer"
+  "../bin/page_buffer.pdb"
+  "CMakeFiles/page_buffer.dir/page_buffer.c.o"
+  "CMakeFiles/page_buffer.dir/page_buffer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/page_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
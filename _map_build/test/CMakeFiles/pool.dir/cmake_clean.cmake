@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/pool"
+  "../bin/pool.pdb"
+  "CMakeFiles/pool.dir/pool.c.o"
+  "CMakeFiles/pool.dir/pool.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
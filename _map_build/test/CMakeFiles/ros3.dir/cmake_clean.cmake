@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/ros3"
+  "../bin/ros3.pdb"
+  "CMakeFiles/ros3.dir/ros3.c.o"
+  "CMakeFiles/ros3.dir/ros3.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ros3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
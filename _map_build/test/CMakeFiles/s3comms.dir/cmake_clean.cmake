@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/s3comms"
+  "../bin/s3comms.pdb"
+  "CMakeFiles/s3comms.dir/s3comms.c.o"
+  "CMakeFiles/s3comms.dir/s3comms.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/s3comms.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
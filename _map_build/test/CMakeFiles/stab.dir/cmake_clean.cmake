@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/stab"
+  "../bin/stab.pdb"
+  "CMakeFiles/stab.dir/stab.c.o"
+  "CMakeFiles/stab.dir/stab.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/stab.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
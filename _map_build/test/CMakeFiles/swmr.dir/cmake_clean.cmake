@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/swmr"
+  "../bin/swmr.pdb"
+  "CMakeFiles/swmr.dir/swmr.c.o"
+  "CMakeFiles/swmr.dir/swmr.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/swmr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/swmr_sparse_writer"
+  "../bin/swmr_sparse_writer.pdb"
+  "CMakeFiles/swmr_sparse_writer.dir/swmr_sparse_writer.c.o"
+  "CMakeFiles/swmr_sparse_writer.dir/swmr_sparse_writer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/swmr_sparse_writer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tcheck_version"
+  "../bin/tcheck_version.pdb"
+  "CMakeFiles/tcheck_version.dir/tcheck_version.c.o"
+  "CMakeFiles/tcheck_version.dir/tcheck_version.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tcheck_version.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
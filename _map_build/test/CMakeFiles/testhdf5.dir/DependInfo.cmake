@@ -0,0 +1,46 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/tarray.c" "test/CMakeFiles/testhdf5.dir/tarray.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tarray.c.o.d"
+  "/root/repo/test/tattr.c" "test/CMakeFiles/testhdf5.dir/tattr.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tattr.c.o.d"
+  "/root/repo/test/tchecksum.c" "test/CMakeFiles/testhdf5.dir/tchecksum.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tchecksum.c.o.d"
+  "/root/repo/test/tconfig.c" "test/CMakeFiles/testhdf5.dir/tconfig.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tconfig.c.o.d"
+  "/root/repo/test/tcoords.c" "test/CMakeFiles/testhdf5.dir/tcoords.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tcoords.c.o.d"
+  "/root/repo/test/testhdf5.c" "test/CMakeFiles/testhdf5.dir/testhdf5.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/testhdf5.c.o.d"
+  "/root/repo/test/tfile.c" "test/CMakeFiles/testhdf5.dir/tfile.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tfile.c.o.d"
+  "/root/repo/test/tgenprop.c" "test/CMakeFiles/testhdf5.dir/tgenprop.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tgenprop.c.o.d"
+  "/root/repo/test/th5o.c" "test/CMakeFiles/testhdf5.dir/th5o.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/th5o.c.o.d"
+  "/root/repo/test/th5s.c" "test/CMakeFiles/testhdf5.dir/th5s.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/th5s.c.o.d"
+  "/root/repo/test/theap.c" "test/CMakeFiles/testhdf5.dir/theap.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/theap.c.o.d"
+  "/root/repo/test/tid.c" "test/CMakeFiles/testhdf5.dir/tid.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tid.c.o.d"
+  "/root/repo/test/titerate.c" "test/CMakeFiles/testhdf5.dir/titerate.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/titerate.c.o.d"
+  "/root/repo/test/tmeta.c" "test/CMakeFiles/testhdf5.dir/tmeta.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tmeta.c.o.d"
+  "/root/repo/test/tmisc.c" "test/CMakeFiles/testhdf5.dir/tmisc.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tmisc.c.o.d"
+  "/root/repo/test/trefer.c" "test/CMakeFiles/testhdf5.dir/trefer.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/trefer.c.o.d"
+  "/root/repo/test/trefer_deprec.c" "test/CMakeFiles/testhdf5.dir/trefer_deprec.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/trefer_deprec.c.o.d"
+  "/root/repo/test/trefstr.c" "test/CMakeFiles/testhdf5.dir/trefstr.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/trefstr.c.o.d"
+  "/root/repo/test/tselect.c" "test/CMakeFiles/testhdf5.dir/tselect.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tselect.c.o.d"
+  "/root/repo/test/tskiplist.c" "test/CMakeFiles/testhdf5.dir/tskiplist.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tskiplist.c.o.d"
+  "/root/repo/test/tsohm.c" "test/CMakeFiles/testhdf5.dir/tsohm.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tsohm.c.o.d"
+  "/root/repo/test/ttime.c" "test/CMakeFiles/testhdf5.dir/ttime.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/ttime.c.o.d"
+  "/root/repo/test/ttst.c" "test/CMakeFiles/testhdf5.dir/ttst.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/ttst.c.o.d"
+  "/root/repo/test/tunicode.c" "test/CMakeFiles/testhdf5.dir/tunicode.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tunicode.c.o.d"
+  "/root/repo/test/tvlstr.c" "test/CMakeFiles/testhdf5.dir/tvlstr.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tvlstr.c.o.d"
+  "/root/repo/test/tvltypes.c" "test/CMakeFiles/testhdf5.dir/tvltypes.c.o" "gcc" "test/CMakeFiles/testhdf5.dir/tvltypes.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_map_build/test/CMakeFiles/hdf5_test-static.dir/DependInfo.cmake"
+  "/root/repo/_map_build/src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/testmeta"
+  "../bin/testmeta.pdb"
+  "CMakeFiles/testmeta.dir/testmeta.c.o"
+  "CMakeFiles/testmeta.dir/testmeta.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testmeta.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/thread_id"
+  "../bin/thread_id.pdb"
+  "CMakeFiles/thread_id.dir/thread_id.c.o"
+  "CMakeFiles/thread_id.dir/thread_id.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/thread_id.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
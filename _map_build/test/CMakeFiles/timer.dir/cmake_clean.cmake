@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/timer"
+  "../bin/timer.pdb"
+  "CMakeFiles/timer.dir/timer.c.o"
+  "CMakeFiles/timer.dir/timer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/timer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/twriteorder"
+  "../bin/twriteorder.pdb"
+  "CMakeFiles/twriteorder.dir/twriteorder.c.o"
+  "CMakeFiles/twriteorder.dir/twriteorder.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/twriteorder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/unregister"
+  "../bin/unregister.pdb"
+  "CMakeFiles/unregister.dir/unregister.c.o"
+  "CMakeFiles/unregister.dir/unregister.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unregister.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/use_append_chunk"
+  "../bin/use_append_chunk.pdb"
+  "CMakeFiles/use_append_chunk.dir/use_append_chunk.c.o"
+  "CMakeFiles/use_append_chunk.dir/use_append_chunk.c.o.d"
+  "CMakeFiles/use_append_chunk.dir/use_common.c.o"
+  "CMakeFiles/use_append_chunk.dir/use_common.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/use_append_chunk.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
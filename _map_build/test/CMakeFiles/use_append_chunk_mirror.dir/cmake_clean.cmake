@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/use_append_chunk_mirror"
+  "../bin/use_append_chunk_mirror.pdb"
+  "CMakeFiles/use_append_chunk_mirror.dir/use_append_chunk_mirror.c.o"
+  "CMakeFiles/use_append_chunk_mirror.dir/use_append_chunk_mirror.c.o.d"
+  "CMakeFiles/use_append_chunk_mirror.dir/use_common.c.o"
+  "CMakeFiles/use_append_chunk_mirror.dir/use_common.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/use_append_chunk_mirror.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
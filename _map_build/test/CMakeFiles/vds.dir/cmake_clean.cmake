@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/vds"
+  "../bin/vds.pdb"
+  "CMakeFiles/vds.dir/vds.c.o"
+  "CMakeFiles/vds.dir/vds.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/vds.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
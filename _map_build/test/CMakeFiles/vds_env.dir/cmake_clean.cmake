@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/vds_env"
+  "../bin/vds_env.pdb"
+  "CMakeFiles/vds_env.dir/vds_env.c.o"
+  "CMakeFiles/vds_env.dir/vds_env.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/vds_env.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
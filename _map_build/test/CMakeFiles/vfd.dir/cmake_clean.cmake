@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/vfd"
+  "../bin/vfd.pdb"
+  "CMakeFiles/vfd.dir/vfd.c.o"
+  "CMakeFiles/vfd.dir/vfd.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/vfd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
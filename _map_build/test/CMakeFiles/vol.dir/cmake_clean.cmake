@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/vol"
+  "../bin/vol.pdb"
+  "CMakeFiles/vol.dir/vol.c.o"
+  "CMakeFiles/vol.dir/vol.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/vol.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,192 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_map_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(H5TEST-testhdf5-clear-objects "/usr/bin/cmake" "-E" "remove" "coord.h5" "dtypes10.h5" "sys_file1" "tattr.h5" "tfile1.h5" "tfile2.h5" "tfile3.h5" "tfile4.h5" "tfile5.h5" "tfile6.h5" "tfile7.h5" "tfilespace.h5" "th5o_file" "th5s1.h5" "tselect.h5" "tsohm.h5" "tsohm_dst.h5" "tsohm_src.h5")
+set_tests_properties(H5TEST-testhdf5-clear-objects PROPERTIES  FIXTURES_SETUP "clear_testhdf5" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;201;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-testhdf5-base "/root/repo/_map_build/bin/testhdf5" "-x" "heap" "-x" "file" "-x" "select")
+set_tests_properties(H5TEST-testhdf5-base PROPERTIES  ENVIRONMENT "HDF5_ALARM_SECONDS=3600;srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_testhdf5" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;208;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-testhdf5-heap "/root/repo/_map_build/bin/testhdf5" "-o" "heap")
+set_tests_properties(H5TEST-testhdf5-heap PROPERTIES  ENVIRONMENT "HDF5_ALARM_SECONDS=3600;srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_testhdf5" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;214;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-testhdf5-file "/root/repo/_map_build/bin/testhdf5" "-o" "file")
+set_tests_properties(H5TEST-testhdf5-file PROPERTIES  ENVIRONMENT "HDF5_ALARM_SECONDS=3600;srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_testhdf5" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;220;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-testhdf5-select "/root/repo/_map_build/bin/testhdf5" "-o" "select")
+set_tests_properties(H5TEST-testhdf5-select PROPERTIES  ENVIRONMENT "HDF5_ALARM_SECONDS=3600;srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_testhdf5" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;226;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-clear-objects "/usr/bin/cmake" "-E" "remove" "accum.h5" "cmpd_dset.h5" "compact_dataset.h5" "dataset.h5" "dset_offset.h5" "max_compact_dataset.h5" "simple.h5" "set_local.h5" "random_chunks.h5" "huge_chunks.h5" "chunk_cache.h5" "big_chunk.h5" "chunk_fast.h5" "chunk_expand.h5" "chunk_fixed.h5" "copy_dcpl_newfile.h5" "partial_chunks.h5" "layout_extend.h5" "zero_chunk.h5" "chunk_single.h5" "swmr_non_latest.h5" "earray_hdr_fd.h5" "farray_hdr_fd.h5" "bt2_hdr_fd.h5" "storage_size.h5" "dls_01_strings.h5" "power2up.h5" "version_bounds.h5" "alloc_0sized.h5" "extend.h5" "istore.h5" "extlinks*.h5" "frspace.h5" "links*.h5" "sys_file1" "tfile*.h5" "th5s*.h5" "lheap.h5" "fheap.h5" "ohdr.h5" "ohdr_min_a.h5" "ohdr_min_b.h5" "min_dset_ohdr_testfile.h5" "stab.h5" "extern_*.h5" "extern_*.raw" "gheap*.h5" "dt_arith1" "dt_arith2" "links.h5" "links*.h5" "extlinks*.h5" "tmp" "tmp_links" "tmp2_links" "tmp_links_env" "tmp_vds/*" "tmp_vds_env/*" "big.data" "big*.h5" "stdio.h5" "sec2.h5" "dtypes*.h5" "dt_arith*.h5" "tattr.h5" "tselect.h5" "mtime.h5" "unlink.h5" "unicode.h5" "coord.h5" "fillval_*.h5" "fillval.raw" "mount_*.h5" "testmeta.h5" "ttime.h5" "trefer*.h5" "trefer_*.h5" "tvltypes.h5" "tvlstr.h5" "tvlstr2.h5" "twriteorder.dat" "flush.h5" "flush-swmr.h5" "noflush.h5" "noflush-swmr.h5" "flush_extend.h5" "flush_extend-swmr.h5" "noflush_extend.h5" "noflush_extend-swmr.h5" "enum1.h5" "titerate.h5" "ttsafe.h5" "tarray1.h5" "tgenprop.h5" "tmisc*.h5" "set_extent*.h5" "ext*.bin" "getname.h5" "getname*.h5" "sec2_file.h5" "direct_file.h5" "family_file000*.h5" "new_family_v16_000*.h5" "multi_file-*.h5" "core_file" "filter_plugin.h5" "new_move_*.h5" "ntypes.h5" "dangle.h5" "error_test.h5" "err_compat.h5" "dtransform.h5" "test_filters.h5" "get_file_name.h5" "tstint*.h5" "unlink_chunked.h5" "btree2.h5" "btree2_tmp.h5" "objcopy_src.h5" "objcopy_dst.h5" "objcopy_ext.dat" "app_ref.h5" "farray.h5" "farray_tmp.h5" "earray.h5" "earray_tmp.h5" "efc*.h5" "log_vfd_out.log" "log_ros3_out.log" "log_s3comms_out.log" "new_multi_file_v16-r.h5" "new_multi_file_v16-s.h5" "split_get_file_image_test-m.h5" "split_get_file_image_test-r.h5" "file_image_core_test.h5.copy" "unregister_filter_1.h5" "unregister_filter_2.h5" "vds_virt.h5" "map.h5" "vds_dapl.h5" "vds_src_*.h5" "swmr_data.h5" "use_use_append_chunk.h5" "use_append_mchunks.h5" "use_disable_mdc_flushes.h5" "flushrefresh.h5" "flushrefresh_VERIFICATION_START" "flushrefresh_VERIFICATION_CHECKPOINT1" "flushrefresh_VERIFICATION_CHECKPOINT2" "flushrefresh_VERIFICATION_DONE" "filenotclosed.h5" "del_many_dense_attrs.h5" "atomic_data" "accum_swmr_big.h5" "ohdr_swmr.h5" "test_swmr*.h5" "cache_logging.h5" "cache_logging.out" "vds_swmr.h5" "vds_swmr_src_*.h5" "swmr*.h5" "swmr_writer.out" "swmr_writer.log.*" "swmr_reader.out.*" "swmr_reader.log.*" "tbogus.h5.copy" "cache_image_test.h5" "direct_chunk.h5" "native_vol_test.h5" "splitter*.h5" "splitter.log" "mirror_rw/*" "mirror_wo/*" "event_set_*.h5")
+set_tests_properties(H5TEST-clear-objects PROPERTIES  FIXTURES_SETUP "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;417;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cache_api "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cache_api" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cache_api.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-cache_api PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cache_tagging "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cache_tagging" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cache_tagging.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-cache_tagging PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-lheap "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/lheap" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=lheap.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-lheap PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-ohdr "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/ohdr" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=ohdr.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-ohdr PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-stab "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/stab" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=stab.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-stab PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-gheap "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/gheap" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=gheap.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-gheap PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-evict_on_close "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/evict_on_close" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=evict_on_close.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-evict_on_close PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-farray "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/farray" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=farray.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-farray PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-earray "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/earray" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=earray.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-earray PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-btree2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/btree2" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=btree2.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-btree2 PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" TIMEOUT "3600" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-fheap "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/fheap" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=fheap.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-fheap PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" TIMEOUT "3600" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-pool "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/pool" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=pool.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-pool PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-accum "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/accum" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=accum.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-accum PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-hyperslab "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hyperslab" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hyperslab.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-hyperslab PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-istore "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/istore" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=istore.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-istore PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-bittests "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/bittests" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=bittests.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-bittests PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-dt_arith "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/dt_arith" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=dt_arith.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-dt_arith PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-page_buffer "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/page_buffer" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=page_buffer.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-page_buffer PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-dtypes "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/dtypes" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=dtypes.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-dtypes PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-dsets "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/dsets" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=dsets.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-dsets PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-chunk_info "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/chunk_info" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=chunk_info.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-chunk_info PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cmpd_dset "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cmpd_dset" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cmpd_dset.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-cmpd_dset PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-filter_fail "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/filter_fail" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=filter_fail.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-filter_fail PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-extend "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/extend" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=extend.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-extend PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-direct_chunk "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/direct_chunk" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=direct_chunk.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-direct_chunk PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-external "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/external" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=external.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-external PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-efc "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/efc" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=efc.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-efc PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-objcopy_ref "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/objcopy_ref" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=objcopy_ref.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-objcopy_ref PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-objcopy "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/objcopy" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=objcopy.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-objcopy PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" TIMEOUT "3600" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-links "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/links" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=links.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-links PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-unlink "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/unlink" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=unlink.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-unlink PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-twriteorder "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/twriteorder" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=twriteorder.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-twriteorder PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-big "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/big" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=big.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-big PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" TIMEOUT "3600" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-mtime "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/mtime" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=mtime.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-mtime PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-fillval "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/fillval" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=fillval.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-fillval PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-mount "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/mount" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=mount.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-mount PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-app_ref "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/app_ref" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=app_ref.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-app_ref PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-enum "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/enum" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=enum.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-enum PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-set_extent "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/set_extent" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=set_extent.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-set_extent PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-ttsafe "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/ttsafe" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=ttsafe.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-ttsafe PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-enc_dec_plist "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/enc_dec_plist" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=enc_dec_plist.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-enc_dec_plist PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-enc_dec_plist_cross_platform "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/enc_dec_plist_cross_platform" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=enc_dec_plist_cross_platform.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-enc_dec_plist_cross_platform PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-getname "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/getname" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=getname.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-getname PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-vfd "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/vfd" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=vfd.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-vfd PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-ros3 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/ros3" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=ros3.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-ros3 PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-s3comms "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/s3comms" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=s3comms.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-s3comms PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-hdfs "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/hdfs" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=hdfs.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-hdfs PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-mirror_vfd "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/mirror_vfd" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=mirror_vfd.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-mirror_vfd PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-ntypes "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/ntypes" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=ntypes.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-ntypes PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-dangle "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/dangle" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=dangle.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-dangle PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-dtransform "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/dtransform" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=dtransform.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-dtransform PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cross_read "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cross_read" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cross_read.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-cross_read PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-freespace "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/freespace" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=freespace.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-freespace PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-mf "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/mf" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=mf.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-mf PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-vds "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/vds" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=vds.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-vds PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-file_image "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/file_image" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=file_image.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-file_image PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-unregister "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/unregister" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=unregister.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-unregister PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cache_logging "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cache_logging" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cache_logging.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-cache_logging PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cork "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cork" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cork.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-cork PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-swmr "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/swmr" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=swmr.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-swmr PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-thread_id "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/thread_id" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=thread_id.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-thread_id PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-vol "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/vol" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=vol.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-vol PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-timer "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/timer" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=timer.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-timer PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cmpd_dtransform "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cmpd_dtransform" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cmpd_dtransform.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-cmpd_dtransform PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-event_set "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/event_set" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=event_set.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-event_set PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-map "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/map" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=map.txt" "-D" "TEST_LIBRARY_DIRECTORY=/root/repo/_map_build/bin" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-map PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;448;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cache-clear-objects "/usr/bin/cmake" "-E" "remove" "cache_test.h5")
+set_tests_properties(H5TEST-cache-clear-objects PROPERTIES  FIXTURES_SETUP "clear_cache" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;477;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cache "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/cache" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cache.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-cache PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST;HDF5TestExpress=OFF" FIXTURES_REQUIRED "clear_cache" TIMEOUT "3600" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;486;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-external_env-clear-objects "/usr/bin/cmake" "-E" "remove" "extern_1r.raw" "extern_2r.raw" "extern_3r.raw" "extern_4r.raw" "extern_1w.raw" "extern_2w.raw" "extern_3w.raw" "extern_4w.raw")
+set_tests_properties(H5TEST-external_env-clear-objects PROPERTIES  FIXTURES_SETUP "clear_external_env" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;523;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-external_env "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/external_env" "-D" "TEST_ARGS:STRING=" "-D" "TEST_ENV_VAR:STRING=HDF5_EXTFILE_PREFIX" "-D" "TEST_ENV_VALUE:STRING=\${ORIGIN}" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=external_env.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-external_env PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST;HDF5TestExpress=OFF" FIXTURES_REQUIRED "clear_external_env" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;541;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-vds_env-clear-objects "/usr/bin/cmake" "-E" "remove" "vds_virt_0.h5" "vds_virt_3.h5" "vds_src_2.h5")
+set_tests_properties(H5TEST-vds_env-clear-objects PROPERTIES  FIXTURES_SETUP "clear_vds_env" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;562;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-vds_env "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/vds_env" "-D" "TEST_ARGS:STRING=" "-D" "TEST_ENV_VAR:STRING=HDF5_VDS_PREFIX" "-D" "TEST_ENV_VALUE:STRING=\${ORIGIN}/tmp_vds_env" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=vds_env.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-vds_env PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST;HDF5TestExpress=OFF" FIXTURES_REQUIRED "clear_vds_env" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;575;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-flush-clear-objects "/usr/bin/cmake" "-E" "remove" "flush.h5" "flush-swmr.h5" "noflush.h5" "noflush-swmr.h5" "flush_extend.h5" "flush_extend-swmr.h5" "noflush_extend.h5" "noflush_extend-swmr.h5")
+set_tests_properties(H5TEST-flush-clear-objects PROPERTIES  FIXTURES_SETUP "clear_flush" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;596;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-flush1 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/flush1" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=flush1.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-flush1 PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST;HDF5TestExpress=OFF" FIXTURES_REQUIRED "clear_flush" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;613;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-flush2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/flush2" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=flush2.txt" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-flush2 PROPERTIES  DEPENDS "H5TEST-flush1" FIXTURES_REQUIRED "clear_flush" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;632;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-tcheck_version-major "/root/repo/_map_build/bin/tcheck_version" "-tM")
+set_tests_properties(H5TEST-tcheck_version-major PROPERTIES  WILL_FAIL "true" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;649;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-tcheck_version-minor "/root/repo/_map_build/bin/tcheck_version" "-tm")
+set_tests_properties(H5TEST-tcheck_version-minor PROPERTIES  WILL_FAIL "true" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;654;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-tcheck_version-release "/root/repo/_map_build/bin/tcheck_version" "-tr")
+set_tests_properties(H5TEST-tcheck_version-release PROPERTIES  WILL_FAIL "true" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;659;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-filenotclosed-clear-objects "/usr/bin/cmake" "-E" "remove" "filenotclosed.h5")
+set_tests_properties(H5TEST-filenotclosed-clear-objects PROPERTIES  FIXTURES_SETUP "clear_filenotclosed" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;698;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-filenotclosed "/root/repo/_map_build/bin/filenotclosed")
+set_tests_properties(H5TEST-filenotclosed PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_filenotclosed" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;704;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-del_many_dense_attrs-clear-objects "/usr/bin/cmake" "-E" "remove" "del_many_dense_attrs.h5")
+set_tests_properties(H5TEST-del_many_dense_attrs-clear-objects PROPERTIES  FIXTURES_SETUP "clear_del_many_dense_attrs" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;712;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-del_many_dense_attrs "/root/repo/_map_build/bin/del_many_dense_attrs")
+set_tests_properties(H5TEST-del_many_dense_attrs PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" FIXTURES_REQUIRED "clear_del_many_dense_attrs" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;718;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-err_compat "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/err_compat" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_MASK_ERROR=true" "-D" "ERROR_APPEND=1" "-D" "TEST_OUTPUT=err_compat.txt" "-D" "TEST_REFERENCE=err_compat_1" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-err_compat PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;727;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-error_test "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/error_test" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_MASK_ERROR=true" "-D" "ERROR_APPEND=1" "-D" "TEST_OUTPUT=error_test.txt" "-D" "TEST_REFERENCE=error_test_1" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-error_test PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST;HDF5_PLUGIN_PRELOAD=::" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;781;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-links_env-clear-objects "/usr/bin/cmake" "-E" "remove" "extlinks_env0.h5" "extlinks_env1.h5" "tmp_links_env/extlinks_env1.h5")
+set_tests_properties(H5TEST-links_env-clear-objects PROPERTIES  FIXTURES_SETUP "clear_links_env" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;800;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-links_env "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/links_env" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=links_env.txt" "-D" "TEST_REFERENCE=links_env.out" "-D" "TEST_FOLDER=/root/repo/_map_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-links_env PROPERTIES  ENVIRONMENT "srcdir=/root/repo/_map_build/test/H5TEST;HDF5_EXT_PREFIX=.:tmp_links_env" FIXTURES_REQUIRED "clear_links_env" WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;812;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-testlibinfo "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_map_build/bin/libhdf5_debug.a" "-P" "/root/repo/_map_build/test/GrepRunner.cmake")
+set_tests_properties(H5TEST-testlibinfo PROPERTIES  WORKING_DIRECTORY "/root/repo/_map_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;833;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;783;include;/root/repo/test/CMakeLists.txt;0;")
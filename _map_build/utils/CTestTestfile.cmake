@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/utils
+# Build directory: /root/repo/_map_build/utils
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("mirror_vfd")
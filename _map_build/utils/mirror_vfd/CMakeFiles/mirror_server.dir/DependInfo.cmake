@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/utils/mirror_vfd/mirror_remote.c" "utils/mirror_vfd/CMakeFiles/mirror_server.dir/mirror_remote.c.o" "gcc" "utils/mirror_vfd/CMakeFiles/mirror_server.dir/mirror_remote.c.o.d"
+  "/root/repo/utils/mirror_vfd/mirror_server.c" "utils/mirror_vfd/CMakeFiles/mirror_server.dir/mirror_server.c.o" "gcc" "utils/mirror_vfd/CMakeFiles/mirror_server.dir/mirror_server.c.o.d"
+  "/root/repo/utils/mirror_vfd/mirror_writer.c" "utils/mirror_vfd/CMakeFiles/mirror_server.dir/mirror_writer.c.o" "gcc" "utils/mirror_vfd/CMakeFiles/mirror_server.dir/mirror_writer.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_map_build/src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/mirror_server"
+  "../../bin/mirror_server.pdb"
+  "CMakeFiles/mirror_server.dir/mirror_remote.c.o"
+  "CMakeFiles/mirror_server.dir/mirror_remote.c.o.d"
+  "CMakeFiles/mirror_server.dir/mirror_server.c.o"
+  "CMakeFiles/mirror_server.dir/mirror_server.c.o.d"
+  "CMakeFiles/mirror_server.dir/mirror_writer.c.o"
+  "CMakeFiles/mirror_server.dir/mirror_writer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mirror_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/mirror_server_stop"
+  "../../bin/mirror_server_stop.pdb"
+  "CMakeFiles/mirror_server_stop.dir/mirror_server_stop.c.o"
+  "CMakeFiles/mirror_server_stop.dir/mirror_server_stop.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mirror_server_stop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/utils/mirror_vfd
+# Build directory: /root/repo/_map_build/utils/mirror_vfd
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
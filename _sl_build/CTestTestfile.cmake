@@ -0,0 +1,13 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_sl_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("src")
+subdirs("test")
+subdirs("utils")
+subdirs("tools")
+subdirs("hl")
+subdirs("c++")
+subdirs("hl/c++")
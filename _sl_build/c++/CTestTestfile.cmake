@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/c++
+# Build directory: /root/repo/_sl_build/c++
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("src")
+subdirs("test")
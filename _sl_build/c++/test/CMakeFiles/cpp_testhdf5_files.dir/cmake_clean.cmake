@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cpp_testhdf5_files"
+  "th5s.h5"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/cpp_testhdf5_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
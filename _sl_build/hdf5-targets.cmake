@@ -0,0 +1,301 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS hdf5-static hdf5_tools-static hdf5_hl-static hdf5_cpp-static hdf5_hl_cpp-static mirror_server mirror_server_stop h5diff h5ls h5debug h5repart h5mkgrp h5clear h5delete h5import h5repack h5jam h5unjam h5copy h5stat h5dump h5format_convert gif2h5 h52gif)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Create imported target hdf5-static
+add_library(hdf5-static STATIC IMPORTED)
+
+set_target_properties(hdf5-static PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "_POSIX_C_SOURCE=200809L;_GNU_SOURCE"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_sl_build/src;/root/repo/_sl_build/src;/root/repo/src"
+  INTERFACE_LINK_LIBRARIES "\$<LINK_ONLY:m>;\$<LINK_ONLY:dl>;\$<LINK_ONLY:\$<\$<BOOL:OFF>:>>;\$<\$<NOT:\$<PLATFORM_ID:Windows>>:dl>;\$<LINK_ONLY:\$<\$<BOOL:OFF>:Threads::Threads>>"
+)
+
+# Create imported target hdf5_tools-static
+add_library(hdf5_tools-static STATIC IMPORTED)
+
+set_target_properties(hdf5_tools-static PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_sl_build/tools/lib;/root/repo/tools/lib"
+  INTERFACE_LINK_LIBRARIES "hdf5-static;\$<LINK_ONLY:\$<\$<BOOL:OFF>:>>"
+)
+
+# Create imported target hdf5_hl-static
+add_library(hdf5_hl-static STATIC IMPORTED)
+
+set_target_properties(hdf5_hl-static PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_sl_build/hl/src;/root/repo/hl/src"
+  INTERFACE_LINK_LIBRARIES "hdf5-static"
+)
+
+# Create imported target hdf5_cpp-static
+add_library(hdf5_cpp-static STATIC IMPORTED)
+
+set_target_properties(hdf5_cpp-static PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_sl_build/c++/src;/root/repo/c++/src"
+  INTERFACE_LINK_LIBRARIES "hdf5-static"
+)
+
+# Create imported target hdf5_hl_cpp-static
+add_library(hdf5_hl_cpp-static STATIC IMPORTED)
+
+set_target_properties(hdf5_hl_cpp-static PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_sl_build/hl/c++/src;/root/repo/hl/c++/src"
+  INTERFACE_LINK_LIBRARIES "hdf5_hl-static;hdf5-static"
+)
+
+# Create imported target mirror_server
+add_executable(mirror_server IMPORTED)
+
+# Create imported target mirror_server_stop
+add_executable(mirror_server_stop IMPORTED)
+
+# Create imported target h5diff
+add_executable(h5diff IMPORTED)
+
+# Create imported target h5ls
+add_executable(h5ls IMPORTED)
+
+# Create imported target h5debug
+add_executable(h5debug IMPORTED)
+
+# Create imported target h5repart
+add_executable(h5repart IMPORTED)
+
+# Create imported target h5mkgrp
+add_executable(h5mkgrp IMPORTED)
+
+# Create imported target h5clear
+add_executable(h5clear IMPORTED)
+
+# Create imported target h5delete
+add_executable(h5delete IMPORTED)
+
+# Create imported target h5import
+add_executable(h5import IMPORTED)
+
+# Create imported target h5repack
+add_executable(h5repack IMPORTED)
+
+# Create imported target h5jam
+add_executable(h5jam IMPORTED)
+
+# Create imported target h5unjam
+add_executable(h5unjam IMPORTED)
+
+# Create imported target h5copy
+add_executable(h5copy IMPORTED)
+
+# Create imported target h5stat
+add_executable(h5stat IMPORTED)
+
+# Create imported target h5dump
+add_executable(h5dump IMPORTED)
+
+# Create imported target h5format_convert
+add_executable(h5format_convert IMPORTED)
+
+# Create imported target gif2h5
+add_executable(gif2h5 IMPORTED)
+
+# Create imported target h52gif
+add_executable(h52gif IMPORTED)
+
+# Import target "hdf5-static" for configuration "Debug"
+set_property(TARGET hdf5-static APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(hdf5-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "C"
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/libhdf5_debug.a"
+  )
+
+# Import target "hdf5_tools-static" for configuration "Debug"
+set_property(TARGET hdf5_tools-static APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(hdf5_tools-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "C"
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/libhdf5_tools_debug.a"
+  )
+
+# Import target "hdf5_hl-static" for configuration "Debug"
+set_property(TARGET hdf5_hl-static APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(hdf5_hl-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "C"
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/libhdf5_hl_debug.a"
+  )
+
+# Import target "hdf5_cpp-static" for configuration "Debug"
+set_property(TARGET hdf5_cpp-static APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(hdf5_cpp-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/libhdf5_cpp_debug.a"
+  )
+
+# Import target "hdf5_hl_cpp-static" for configuration "Debug"
+set_property(TARGET hdf5_hl_cpp-static APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(hdf5_hl_cpp-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/libhdf5_hl_cpp_debug.a"
+  )
+
+# Import target "mirror_server" for configuration "Debug"
+set_property(TARGET mirror_server APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(mirror_server PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/mirror_server"
+  )
+
+# Import target "mirror_server_stop" for configuration "Debug"
+set_property(TARGET mirror_server_stop APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(mirror_server_stop PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/mirror_server_stop"
+  )
+
+# Import target "h5diff" for configuration "Debug"
+set_property(TARGET h5diff APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h5diff PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h5diff"
+  )
+
+# Import target "h5ls" for configuration "Debug"
+set_property(TARGET h5ls APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h5ls PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h5ls"
+  )
+
+# Import target "h5debug" for configuration "Debug"
+set_property(TARGET h5debug APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h5debug PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h5debug"
+  )
+
+# Import target "h5repart" for configuration "Debug"
+set_property(TARGET h5repart APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h5repart PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h5repart"
+  )
+
+# Import target "h5mkgrp" for configuration "Debug"
+set_property(TARGET h5mkgrp APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h5mkgrp PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h5mkgrp"
+  )
+
+# Import target "h5clear" for configuration "Debug"
+set_property(TARGET h5clear APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h5clear PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h5clear"
+  )
+
+# Import target "h5delete" for configuration "Debug"
+set_property(TARGET h5delete APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h5delete PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h5delete"
+  )
+
+# Import target "h5import" for configuration "Debug"
+set_property(TARGET h5import APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h5import PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h5import"
+  )
+
+# Import target "h5repack" for configuration "Debug"
+set_property(TARGET h5repack APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h5repack PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h5repack"
+  )
+
+# Import target "h5jam" for configuration "Debug"
+set_property(TARGET h5jam APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h5jam PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h5jam"
+  )
+
+# Import target "h5unjam" for configuration "Debug"
+set_property(TARGET h5unjam APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h5unjam PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h5unjam"
+  )
+
+# Import target "h5copy" for configuration "Debug"
+set_property(TARGET h5copy APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h5copy PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h5copy"
+  )
+
+# Import target "h5stat" for configuration "Debug"
+set_property(TARGET h5stat APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h5stat PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h5stat"
+  )
+
+# Import target "h5dump" for configuration "Debug"
+set_property(TARGET h5dump APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h5dump PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h5dump"
+  )
+
+# Import target "h5format_convert" for configuration "Debug"
+set_property(TARGET h5format_convert APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h5format_convert PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h5format_convert"
+  )
+
+# Import target "gif2h5" for configuration "Debug"
+set_property(TARGET gif2h5 APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(gif2h5 PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/gif2h5"
+  )
+
+# Import target "h52gif" for configuration "Debug"
+set_property(TARGET h52gif APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(h52gif PROPERTIES
+  IMPORTED_LOCATION_DEBUG "/root/repo/_sl_build/bin/h52gif"
+  )
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
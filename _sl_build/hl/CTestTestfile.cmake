@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/hl
+# Build directory: /root/repo/_sl_build/hl
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("src")
+subdirs("tools")
+subdirs("test")
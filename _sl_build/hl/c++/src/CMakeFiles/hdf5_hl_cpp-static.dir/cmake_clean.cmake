@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/libhdf5_hl_cpp_debug.a"
+  "../../../bin/libhdf5_hl_cpp_debug.pdb"
+  "CMakeFiles/hdf5_hl_cpp-static.dir/H5PacketTable.cpp.o"
+  "CMakeFiles/hdf5_hl_cpp-static.dir/H5PacketTable.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hdf5_hl_cpp-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/hl/src/H5DO.c" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5DO.c.o" "gcc" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5DO.c.o.d"
+  "/root/repo/hl/src/H5DS.c" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5DS.c.o" "gcc" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5DS.c.o.d"
+  "/root/repo/hl/src/H5IM.c" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5IM.c.o" "gcc" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5IM.c.o.d"
+  "/root/repo/hl/src/H5LD.c" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5LD.c.o" "gcc" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5LD.c.o.d"
+  "/root/repo/hl/src/H5LT.c" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5LT.c.o" "gcc" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5LT.c.o.d"
+  "/root/repo/hl/src/H5LTanalyze.c" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5LTanalyze.c.o" "gcc" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5LTanalyze.c.o.d"
+  "/root/repo/hl/src/H5LTparse.c" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5LTparse.c.o" "gcc" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5LTparse.c.o.d"
+  "/root/repo/hl/src/H5PT.c" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5PT.c.o" "gcc" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5PT.c.o.d"
+  "/root/repo/hl/src/H5TB.c" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5TB.c.o" "gcc" "hl/src/CMakeFiles/hdf5_hl-static.dir/H5TB.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_sl_build/src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "../../bin/libhdf5_hl_debug.a"
+  "../../bin/libhdf5_hl_debug.pdb"
+  "CMakeFiles/hdf5_hl-static.dir/H5DO.c.o"
+  "CMakeFiles/hdf5_hl-static.dir/H5DO.c.o.d"
+  "CMakeFiles/hdf5_hl-static.dir/H5DS.c.o"
+  "CMakeFiles/hdf5_hl-static.dir/H5DS.c.o.d"
+  "CMakeFiles/hdf5_hl-static.dir/H5IM.c.o"
+  "CMakeFiles/hdf5_hl-static.dir/H5IM.c.o.d"
+  "CMakeFiles/hdf5_hl-static.dir/H5LD.c.o"
+  "CMakeFiles/hdf5_hl-static.dir/H5LD.c.o.d"
+  "CMakeFiles/hdf5_hl-static.dir/H5LT.c.o"
+  "CMakeFiles/hdf5_hl-static.dir/H5LT.c.o.d"
+  "CMakeFiles/hdf5_hl-static.dir/H5LTanalyze.c.o"
+  "CMakeFiles/hdf5_hl-static.dir/H5LTanalyze.c.o.d"
+  "CMakeFiles/hdf5_hl-static.dir/H5LTparse.c.o"
+  "CMakeFiles/hdf5_hl-static.dir/H5LTparse.c.o.d"
+  "CMakeFiles/hdf5_hl-static.dir/H5PT.c.o"
+  "CMakeFiles/hdf5_hl-static.dir/H5PT.c.o.d"
+  "CMakeFiles/hdf5_hl-static.dir/H5TB.c.o"
+  "CMakeFiles/hdf5_hl-static.dir/H5TB.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf5_hl-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
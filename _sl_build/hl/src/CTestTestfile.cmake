@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/hl/src
+# Build directory: /root/repo/_sl_build/hl/src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,24 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hl_test_files"
+  "dsdata.txt"
+  "dslat.txt"
+  "dslon.txt"
+  "dtype_file.txt"
+  "earth.pal"
+  "image24pixel.txt"
+  "image24plane.txt"
+  "image8.txt"
+  "sepia.pal"
+  "test_ds_be.h5"
+  "test_ds_le.h5"
+  "test_ld.h5"
+  "test_table_be.h5"
+  "test_table_cray.h5"
+  "test_table_le.h5"
+  "usa.wri"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/hl_test_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
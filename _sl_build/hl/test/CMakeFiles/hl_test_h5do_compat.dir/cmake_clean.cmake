@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hl_test_h5do_compat"
+  "../../bin/hl_test_h5do_compat.pdb"
+  "CMakeFiles/hl_test_h5do_compat.dir/test_h5do_compat.c.o"
+  "CMakeFiles/hl_test_h5do_compat.dir/test_h5do_compat.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hl_test_h5do_compat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
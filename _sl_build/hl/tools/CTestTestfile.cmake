@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/hl/tools
+# Build directory: /root/repo/_sl_build/hl/tools
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("gif2h5")
+subdirs("h5watch")
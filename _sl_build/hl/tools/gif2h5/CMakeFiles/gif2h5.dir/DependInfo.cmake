@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/hl/tools/gif2h5/decompress.c" "hl/tools/gif2h5/CMakeFiles/gif2h5.dir/decompress.c.o" "gcc" "hl/tools/gif2h5/CMakeFiles/gif2h5.dir/decompress.c.o.d"
+  "/root/repo/hl/tools/gif2h5/gif2hdf.c" "hl/tools/gif2h5/CMakeFiles/gif2h5.dir/gif2hdf.c.o" "gcc" "hl/tools/gif2h5/CMakeFiles/gif2h5.dir/gif2hdf.c.o.d"
+  "/root/repo/hl/tools/gif2h5/gif2mem.c" "hl/tools/gif2h5/CMakeFiles/gif2h5.dir/gif2mem.c.o" "gcc" "hl/tools/gif2h5/CMakeFiles/gif2h5.dir/gif2mem.c.o.d"
+  "/root/repo/hl/tools/gif2h5/gifread.c" "hl/tools/gif2h5/CMakeFiles/gif2h5.dir/gifread.c.o" "gcc" "hl/tools/gif2h5/CMakeFiles/gif2h5.dir/gifread.c.o.d"
+  "/root/repo/hl/tools/gif2h5/writehdf.c" "hl/tools/gif2h5/CMakeFiles/gif2h5.dir/writehdf.c.o" "gcc" "hl/tools/gif2h5/CMakeFiles/gif2h5.dir/writehdf.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_sl_build/hl/src/CMakeFiles/hdf5_hl-static.dir/DependInfo.cmake"
+  "/root/repo/_sl_build/src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  "/root/repo/_sl_build/tools/lib/CMakeFiles/hdf5_tools-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
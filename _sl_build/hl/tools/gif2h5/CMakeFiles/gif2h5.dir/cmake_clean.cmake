@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../../bin/gif2h5"
+  "../../../bin/gif2h5.pdb"
+  "CMakeFiles/gif2h5.dir/decompress.c.o"
+  "CMakeFiles/gif2h5.dir/decompress.c.o.d"
+  "CMakeFiles/gif2h5.dir/gif2hdf.c.o"
+  "CMakeFiles/gif2h5.dir/gif2hdf.c.o.d"
+  "CMakeFiles/gif2h5.dir/gif2mem.c.o"
+  "CMakeFiles/gif2h5.dir/gif2mem.c.o.d"
+  "CMakeFiles/gif2h5.dir/gifread.c.o"
+  "CMakeFiles/gif2h5.dir/gifread.c.o.d"
+  "CMakeFiles/gif2h5.dir/writehdf.c.o"
+  "CMakeFiles/gif2h5.dir/writehdf.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/gif2h5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
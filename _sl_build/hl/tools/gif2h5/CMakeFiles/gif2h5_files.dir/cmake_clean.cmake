@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gif2h5_files"
+  "testfiles/ex_image2.h5"
+  "testfiles/h52giftst.h5"
+  "testfiles/image1.gif"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/gif2h5_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
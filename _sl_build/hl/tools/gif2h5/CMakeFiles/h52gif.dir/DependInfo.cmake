@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/hl/tools/gif2h5/hdf2gif.c" "hl/tools/gif2h5/CMakeFiles/h52gif.dir/hdf2gif.c.o" "gcc" "hl/tools/gif2h5/CMakeFiles/h52gif.dir/hdf2gif.c.o.d"
+  "/root/repo/hl/tools/gif2h5/hdfgifwr.c" "hl/tools/gif2h5/CMakeFiles/h52gif.dir/hdfgifwr.c.o" "gcc" "hl/tools/gif2h5/CMakeFiles/h52gif.dir/hdfgifwr.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_sl_build/hl/src/CMakeFiles/hdf5_hl-static.dir/DependInfo.cmake"
+  "/root/repo/_sl_build/src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  "/root/repo/_sl_build/tools/lib/CMakeFiles/hdf5_tools-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
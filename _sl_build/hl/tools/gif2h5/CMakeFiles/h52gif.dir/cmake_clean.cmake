@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../bin/h52gif"
+  "../../../bin/h52gif.pdb"
+  "CMakeFiles/h52gif.dir/hdf2gif.c.o"
+  "CMakeFiles/h52gif.dir/hdf2gif.c.o.d"
+  "CMakeFiles/h52gif.dir/hdfgifwr.c.o"
+  "CMakeFiles/h52gif.dir/hdfgifwr.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h52gif.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
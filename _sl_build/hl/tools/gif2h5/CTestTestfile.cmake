@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/hl/tools/gif2h5
+# Build directory: /root/repo/_sl_build/hl/tools/gif2h5
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(HL_TOOLS-clear-objects "/usr/bin/cmake" "-E" "remove" "image1.gif" "image1.h5" "image.gif" "image24.gif")
+set_tests_properties(HL_TOOLS-clear-objects PROPERTIES  FIXTURES_SETUP "clear_tools_hl" _BACKTRACE_TRIPLES "/root/repo/hl/tools/gif2h5/CMakeTests.cmake;31;add_test;/root/repo/hl/tools/gif2h5/CMakeTests.cmake;0;;/root/repo/hl/tools/gif2h5/CMakeLists.txt;120;include;/root/repo/hl/tools/gif2h5/CMakeLists.txt;0;")
+add_test(HL_TOOLS_gif2h5 "/root/repo/_sl_build/bin/gif2h5" "testfiles/image1.gif" "image1.h5")
+set_tests_properties(HL_TOOLS_gif2h5 PROPERTIES  FIXTURES_REQUIRED "clear_tools_hl" _BACKTRACE_TRIPLES "/root/repo/hl/tools/gif2h5/CMakeTests.cmake;42;add_test;/root/repo/hl/tools/gif2h5/CMakeTests.cmake;0;;/root/repo/hl/tools/gif2h5/CMakeLists.txt;120;include;/root/repo/hl/tools/gif2h5/CMakeLists.txt;0;")
+add_test(HL_TOOLS_h52gif "/root/repo/_sl_build/bin/h52gif" "testfiles/h52giftst.h5" "image1.gif" "-i" "image")
+set_tests_properties(HL_TOOLS_h52gif PROPERTIES  FIXTURES_REQUIRED "clear_tools_hl" _BACKTRACE_TRIPLES "/root/repo/hl/tools/gif2h5/CMakeTests.cmake;47;add_test;/root/repo/hl/tools/gif2h5/CMakeTests.cmake;0;;/root/repo/hl/tools/gif2h5/CMakeLists.txt;120;include;/root/repo/hl/tools/gif2h5/CMakeLists.txt;0;")
+add_test(HL_TOOLS_h52gif_none "/root/repo/_sl_build/bin/h52gif" "testfiles/h52giftst.h5" "image.gif" "-i" "nosuch_image")
+set_tests_properties(HL_TOOLS_h52gif_none PROPERTIES  FIXTURES_REQUIRED "clear_tools_hl" WILL_FAIL "true" _BACKTRACE_TRIPLES "/root/repo/hl/tools/gif2h5/CMakeTests.cmake;52;add_test;/root/repo/hl/tools/gif2h5/CMakeTests.cmake;0;;/root/repo/hl/tools/gif2h5/CMakeLists.txt;120;include;/root/repo/hl/tools/gif2h5/CMakeLists.txt;0;")
+add_test(HL_TOOLS_h52gif24bits "/root/repo/_sl_build/bin/h52gif" "testfiles/ex_image2.h5" "image24.gif" "-i" "image24bitpixel")
+set_tests_properties(HL_TOOLS_h52gif24bits PROPERTIES  FIXTURES_REQUIRED "clear_tools_hl" WILL_FAIL "true" _BACKTRACE_TRIPLES "/root/repo/hl/tools/gif2h5/CMakeTests.cmake;64;add_test;/root/repo/hl/tools/gif2h5/CMakeTests.cmake;0;;/root/repo/hl/tools/gif2h5/CMakeLists.txt;120;include;/root/repo/hl/tools/gif2h5/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/extend_dset"
+  "../../../bin/extend_dset.pdb"
+  "CMakeFiles/extend_dset.dir/extend_dset.c.o"
+  "CMakeFiles/extend_dset.dir/extend_dset.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/extend_dset.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/h5watch"
+  "../../../bin/h5watch.pdb"
+  "CMakeFiles/h5watch.dir/h5watch.c.o"
+  "CMakeFiles/h5watch.dir/h5watch.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5watch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
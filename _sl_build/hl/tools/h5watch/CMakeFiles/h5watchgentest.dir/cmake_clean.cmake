@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/h5watchgentest"
+  "../../../bin/h5watchgentest.pdb"
+  "CMakeFiles/h5watchgentest.dir/h5watchgentest.c.o"
+  "CMakeFiles/h5watchgentest.dir/h5watchgentest.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5watchgentest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
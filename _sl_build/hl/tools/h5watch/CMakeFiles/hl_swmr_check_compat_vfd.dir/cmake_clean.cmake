@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/hl_swmr_check_compat_vfd"
+  "../../../bin/hl_swmr_check_compat_vfd.pdb"
+  "CMakeFiles/hl_swmr_check_compat_vfd.dir/swmr_check_compat_vfd.c.o"
+  "CMakeFiles/hl_swmr_check_compat_vfd.dir/swmr_check_compat_vfd.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hl_swmr_check_compat_vfd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()